@@ -0,0 +1,155 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+using namespace std;
+
+// Counts every heap allocation made through operator new
+static size_t allocationCount = 0;
+
+void *operator new(size_t size) {
+    ++allocationCount;
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+struct Participant {
+    string name;
+    int score;
+};
+
+struct PooledParticipant {
+    string_view name;
+    int score;
+};
+
+// Bump allocator for names. Bytes are carved out of large blocks and never
+// moved, so the string_views it hands out stay valid for the arena lifetime.
+class NameArena {
+public:
+    explicit NameArena(size_t blockSize = 1 << 20) : blockSize(blockSize), used(0), capacity(0) {}
+
+    string_view intern(string_view s) {
+        char *dst = allocate(s.size());
+        memcpy(dst, s.data(), s.size());
+        return string_view(dst, s.size());
+    }
+
+    // prefix followed by the decimal number, written straight into the arena
+    string_view intern(string_view prefix, unsigned long long number) {
+        char digits[20];
+        char *end = to_chars(digits, digits + sizeof(digits), number).ptr;
+        size_t len = prefix.size() + (end - digits);
+        char *dst = allocate(len);
+        memcpy(dst, prefix.data(), prefix.size());
+        memcpy(dst + prefix.size(), digits, end - digits);
+        return string_view(dst, len);
+    }
+
+    size_t blocks() const { return storage.size(); }
+
+private:
+    size_t blockSize, used, capacity;
+    vector<unique_ptr<char[]>> storage;
+
+    char *allocate(size_t len) {
+        if (used + len > capacity) {
+            capacity = max(blockSize, len);
+            storage.emplace_back(new char[capacity]);
+            used = 0;
+        }
+        char *p = storage.back().get() + used;
+        used += len;
+        return p;
+    }
+};
+
+void measureExecutionTime(int N) {
+    vector<int> scores(N);
+    for (int i = 0; i < N; ++i)
+        scores[i] = rand() % 101; // Random score between 0 and 100
+
+    // Before: one std::string per record, results copied out of the vector
+    size_t allocsBefore = allocationCount;
+    auto start = chrono::high_resolution_clock::now();
+
+    vector<Participant> participants(N);
+    for (int i = 0; i < N; ++i) {
+        participants[i].name = "Participant" + to_string(i + 1);
+        participants[i].score = scores[i];
+    }
+    auto minMaxParticipant = minmax_element(
+        participants.begin(), participants.end(),
+        [](const Participant &p1, const Participant &p2) {
+            return p1.score < p2.score;
+        });
+    Participant minParticipant = *minMaxParticipant.first;
+    Participant maxParticipant = *minMaxParticipant.second;
+
+    double copyTime = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    size_t copyAllocs = allocationCount - allocsBefore;
+
+    // After: names in the arena, results reported as indices
+    allocsBefore = allocationCount;
+    start = chrono::high_resolution_clock::now();
+
+    NameArena arena;
+    vector<PooledParticipant> pooled(N);
+    for (int i = 0; i < N; ++i) {
+        pooled[i].name = arena.intern("Participant", i + 1);
+        pooled[i].score = scores[i];
+    }
+    auto minMaxPooled = minmax_element(
+        pooled.begin(), pooled.end(),
+        [](const PooledParticipant &p1, const PooledParticipant &p2) {
+            return p1.score < p2.score;
+        });
+    size_t minIndex = minMaxPooled.first - pooled.begin();
+    size_t maxIndex = minMaxPooled.second - pooled.begin();
+
+    double arenaTime = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    size_t arenaAllocs = allocationCount - allocsBefore;
+
+    cout << "Number of Participants: " << N << "\n";
+    cout << "std::string names: " << copyTime << " seconds, "
+         << (double)copyAllocs / N << " allocations per record\n";
+    cout << "Arena names: " << arenaTime << " seconds, "
+         << (double)arenaAllocs / N << " allocations per record ("
+         << arena.blocks() << " arena blocks)\n";
+    cout << "Minimum mark participant: " << pooled[minIndex].name << " with score " << pooled[minIndex].score << "\n";
+    cout << "Maximum mark participant: " << pooled[maxIndex].name << " with score " << pooled[maxIndex].score << "\n";
+    if (minParticipant.name != pooled[minIndex].name || maxParticipant.name != pooled[maxIndex].name)
+        cout << "MISMATCH between std::string and arena paths\n";
+    cout << "-----------------------------------------\n";
+}
+
+int main() {
+    srand(time(0)); // Seed for random number generation
+
+    // List of participant counts to test
+    vector<int> participantCounts = {10, 100, 1000, 10000, 100000, 1000000, 10000000};
+
+    for (int count : participantCounts) {
+        measureExecutionTime(count);
+    }
+
+    return 0;
+}
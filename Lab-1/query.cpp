@@ -0,0 +1,221 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+struct Participant {
+    string name;
+    int score;
+};
+
+// Ranking queries over a participant list. Results are indices into the
+// list, so nothing is copied; ties in score are broken by position.
+class ScoreQuery {
+public:
+    explicit ScoreQuery(const vector<Participant> &participants) : p(participants) {}
+
+    // K highest scores, best first. Keeps a K-sized min-heap of the best
+    // seen so far, so it is O(n log K) time and O(K) memory.
+    vector<size_t> topK(size_t k) const {
+        auto higher = [this](size_t a, size_t b) {
+            return p[a].score != p[b].score ? p[a].score > p[b].score : a < b;
+        };
+        return selectK(k, higher);
+    }
+
+    // K lowest scores, lowest first
+    vector<size_t> bottomK(size_t k) const {
+        auto lower = [this](size_t a, size_t b) {
+            return p[a].score != p[b].score ? p[a].score < p[b].score : a < b;
+        };
+        return selectK(k, lower);
+    }
+
+    // Nearest-rank percentile (0..100) with nth_element, O(n) expected
+    int percentile(double pct) const {
+        vector<int> scores = scoreCopy();
+        size_t r = rank(pct, scores.size());
+        nth_element(scores.begin(), scores.begin() + r, scores.end());
+        return scores[r];
+    }
+
+    // Many percentiles at once. When the scores fall in a small range (the
+    // lab data is 0..100) a single counting pass answers every query;
+    // otherwise the queries are sorted and each nth_element only has to
+    // search the part of the array right of the previous answer.
+    vector<int> percentiles(const vector<double> &pcts, int maxRange = 1 << 16) const {
+        vector<int> answers(pcts.size());
+        if (p.empty() || pcts.empty())
+            return answers;
+
+        int lo = p[0].score, hi = p[0].score;
+        for (const Participant &x : p) {
+            lo = min(lo, x.score);
+            hi = max(hi, x.score);
+        }
+        if ((long long)hi - lo < maxRange)
+            return countingPercentiles(pcts, lo, hi);
+        return selectPercentiles(pcts);
+    }
+
+    vector<int> countingPercentiles(const vector<double> &pcts, int lo, int hi) const {
+        vector<size_t> count(hi - lo + 1, 0);
+        for (const Participant &x : p)
+            ++count[x.score - lo];
+
+        vector<size_t> order = queryOrder(pcts);
+        vector<int> answers(pcts.size());
+        size_t seen = 0;
+        int value = lo;
+        for (size_t q : order) {
+            size_t r = rank(pcts[q], p.size());
+            while (seen + count[value - lo] <= r) {
+                seen += count[value - lo];
+                ++value;
+            }
+            answers[q] = value;
+        }
+        return answers;
+    }
+
+    vector<int> selectPercentiles(const vector<double> &pcts) const {
+        vector<int> scores = scoreCopy();
+        vector<size_t> order = queryOrder(pcts);
+        vector<int> answers(pcts.size());
+        auto from = scores.begin();
+        for (size_t q : order) {
+            auto nth = scores.begin() + rank(pcts[q], scores.size());
+            if (nth >= from) {
+                nth_element(from, nth, scores.end());
+                from = nth;
+            }
+            answers[q] = *nth;
+        }
+        return answers;
+    }
+
+private:
+    const vector<Participant> &p;
+
+    // Keeps the k indices that sort first under 'first' (earlier participant
+    // first on equal scores). The heap top is the weakest kept entry, so a
+    // new index only enters if it beats that.
+    template <typename Compare>
+    vector<size_t> selectK(size_t k, Compare first) const {
+        k = min(k, p.size());
+        vector<size_t> heap;
+        heap.reserve(k);
+        if (k == 0)
+            return heap;
+        for (size_t i = 0; i < p.size(); ++i) {
+            if (heap.size() < k) {
+                heap.push_back(i);
+                push_heap(heap.begin(), heap.end(), first);
+            } else if (first(i, heap.front())) {
+                pop_heap(heap.begin(), heap.end(), first);
+                heap.back() = i;
+                push_heap(heap.begin(), heap.end(), first);
+            }
+        }
+        sort_heap(heap.begin(), heap.end(), first);
+        return heap;
+    }
+
+    vector<int> scoreCopy() const {
+        vector<int> scores(p.size());
+        for (size_t i = 0; i < p.size(); ++i)
+            scores[i] = p[i].score;
+        return scores;
+    }
+
+    // 0-based position of the nearest-rank percentile in sorted order
+    static size_t rank(double pct, size_t n) {
+        pct = min(100.0, max(0.0, pct));
+        size_t r = (size_t)ceil(pct / 100.0 * n);
+        return r == 0 ? 0 : r - 1;
+    }
+
+    static vector<size_t> queryOrder(const vector<double> &pcts) {
+        vector<size_t> order(pcts.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        sort(order.begin(), order.end(), [&pcts](size_t a, size_t b) { return pcts[a] < pcts[b]; });
+        return order;
+    }
+};
+
+double secondsSince(chrono::high_resolution_clock::time_point start) {
+    return chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+}
+
+void measureExecutionTime(int N) {
+    vector<Participant> participants(N);
+
+    // Generate random data
+    for (int i = 0; i < N; ++i) {
+        participants[i].name = "Participant" + to_string(i + 1);
+        participants[i].score = rand() % 101; // Random score between 0 and 100
+    }
+
+    ScoreQuery query(participants);
+    vector<double> pcts = {1, 5, 10, 25, 50, 75, 90, 95, 99};
+    size_t k = 5;
+
+    auto start = chrono::high_resolution_clock::now();
+    vector<size_t> top = query.topK(k);
+    double topTime = secondsSince(start);
+
+    start = chrono::high_resolution_clock::now();
+    vector<size_t> bottom = query.bottomK(k);
+    double bottomTime = secondsSince(start);
+
+    start = chrono::high_resolution_clock::now();
+    vector<int> counted = query.percentiles(pcts);
+    double countTime = secondsSince(start);
+
+    start = chrono::high_resolution_clock::now();
+    vector<int> selected = query.selectPercentiles(pcts);
+    double selectTime = secondsSince(start);
+
+    start = chrono::high_resolution_clock::now();
+    vector<int> oneByOne(pcts.size());
+    for (size_t i = 0; i < pcts.size(); ++i)
+        oneByOne[i] = query.percentile(pcts[i]);
+    double singleTime = secondsSince(start);
+
+    cout << "Number of Participants: " << N << "\n";
+    cout << "Top " << k << " (" << topTime << " seconds):";
+    for (size_t i : top)
+        cout << " " << participants[i].name << "=" << participants[i].score;
+    cout << "\nBottom " << k << " (" << bottomTime << " seconds):";
+    for (size_t i : bottom)
+        cout << " " << participants[i].name << "=" << participants[i].score;
+    cout << "\nPercentiles:";
+    for (size_t i = 0; i < pcts.size(); ++i)
+        cout << " p" << pcts[i] << "=" << counted[i];
+    cout << "\nCounting pass: " << countTime << " seconds\n";
+    cout << "Batched nth_element: " << selectTime << " seconds\n";
+    cout << "nth_element per query: " << singleTime << " seconds\n";
+    if (counted != selected || counted != oneByOne)
+        cout << "MISMATCH between percentile methods\n";
+    cout << "-----------------------------------------\n";
+}
+
+int main() {
+    srand(time(0)); // Seed for random number generation
+
+    // List of participant counts to test
+    vector<int> participantCounts = {10, 100, 1000, 10000, 100000, 1000000};
+
+    for (int count : participantCounts) {
+        measureExecutionTime(count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+struct Participant {
+    string name;
+    int score;
+};
+
+// Live min/max over participants keyed by name. Scores are bucketed by
+// value over a fixed range [lo, hi], so every update is O(1) and the min/max
+// cursors only move when their bucket empties, bounded by the range width.
+class ScoreIndex {
+    struct Entry {
+        int score;
+        size_t slot; // position inside buckets[score - lo]
+    };
+    using Node = pair<const string, Entry>;
+
+public:
+    struct Result {
+        const string *name; // nullptr when the index is empty
+        int score;
+    };
+
+    ScoreIndex(int lo = 0, int hi = 100) : lo(lo), hi(hi), buckets(hi - lo + 1), minScore(hi + 1), maxScore(lo - 1) {}
+
+    size_t size() const { return byName.size(); }
+
+    // Adds a participant, or changes the score of an existing one. Returns
+    // false if the score is outside the index range.
+    bool insert(const string &name, int score) {
+        if (score < lo || score > hi)
+            return false;
+        auto it = byName.find(name);
+        if (it != byName.end()) {
+            if (it->second.score == score)
+                return true;
+            unlink(*it);
+            link(*it, score);
+        } else {
+            it = byName.emplace(name, Entry{score, 0}).first;
+            link(*it, score);
+        }
+        return true;
+    }
+
+    bool update(const string &name, int score) {
+        if (byName.find(name) == byName.end())
+            return false;
+        return insert(name, score);
+    }
+
+    bool remove(const string &name) {
+        auto it = byName.find(name);
+        if (it == byName.end())
+            return false;
+        unlink(*it);
+        byName.erase(it);
+        return true;
+    }
+
+    // Any participant holding the lowest / highest score
+    Result min() const {
+        if (byName.empty())
+            return Result{nullptr, 0};
+        return Result{&buckets[minScore - lo].front()->first, minScore};
+    }
+
+    Result max() const {
+        if (byName.empty())
+            return Result{nullptr, 0};
+        return Result{&buckets[maxScore - lo].front()->first, maxScore};
+    }
+
+private:
+    int lo, hi;
+    unordered_map<string, Entry> byName; // node based, so Node* stays valid
+    vector<vector<Node *>> buckets;
+    int minScore, maxScore;
+
+    void link(Node &node, int score) {
+        vector<Node *> &bucket = buckets[score - lo];
+        node.second.score = score;
+        node.second.slot = bucket.size();
+        bucket.push_back(&node);
+        minScore = std::min(minScore, score);
+        maxScore = std::max(maxScore, score);
+    }
+
+    // Swap-removes the node from its bucket and repairs the cursors
+    void unlink(Node &node) {
+        vector<Node *> &bucket = buckets[node.second.score - lo];
+        Node *last = bucket.back();
+        bucket[node.second.slot] = last;
+        last->second.slot = node.second.slot;
+        bucket.pop_back();
+
+        // When the last entry goes away the cursors end up past the range
+        if (!bucket.empty())
+            return;
+        while (minScore <= hi && buckets[minScore - lo].empty())
+            ++minScore;
+        while (maxScore >= lo && buckets[maxScore - lo].empty())
+            --maxScore;
+    }
+};
+
+// Baseline: keep the vector and rescan it with minmax_element per query
+class RescanIndex {
+public:
+    void insert(const string &name, int score) {
+        auto it = position.find(name);
+        if (it != position.end()) {
+            participants[it->second].score = score;
+            return;
+        }
+        position[name] = participants.size();
+        participants.push_back(Participant{name, score});
+    }
+
+    void remove(const string &name) {
+        auto it = position.find(name);
+        if (it == position.end())
+            return;
+        size_t i = it->second;
+        position.erase(it);
+        if (i + 1 != participants.size()) {
+            participants[i] = move(participants.back());
+            position[participants[i].name] = i;
+        }
+        participants.pop_back();
+    }
+
+    size_t size() const { return participants.size(); }
+
+    pair<int, int> minMax() const {
+        auto minMaxParticipant = minmax_element(
+            participants.begin(), participants.end(),
+            [](const Participant &p1, const Participant &p2) {
+                return p1.score < p2.score;
+            });
+        return {minMaxParticipant.first->score, minMaxParticipant.second->score};
+    }
+
+private:
+    vector<Participant> participants;
+    unordered_map<string, size_t> position;
+};
+
+enum OpType { INSERT, UPDATE, REMOVE, QUERY };
+
+struct Op {
+    OpType type;
+    int id;
+    int score;
+};
+
+// Mixed stream: 40% updates, 10% inserts, 10% removes, 40% min/max queries
+vector<Op> generateOps(int N, int count) {
+    vector<Op> ops(count);
+    int nextId = N;
+    for (Op &op : ops) {
+        int r = rand() % 10;
+        op.type = r < 4 ? UPDATE : r < 5 ? INSERT : r < 6 ? REMOVE : QUERY;
+        op.id = op.type == INSERT ? nextId++ : rand() % nextId;
+        op.score = rand() % 101;
+    }
+    return ops;
+}
+
+void measureExecutionTime(int N, int opCount) {
+    vector<string> names;
+    vector<Op> ops = generateOps(N, opCount);
+    int maxId = N;
+    for (const Op &op : ops)
+        maxId = std::max(maxId, op.id + 1);
+    for (int i = 0; i < maxId; ++i)
+        names.push_back("Participant" + to_string(i + 1));
+
+    ScoreIndex index;
+    RescanIndex rescan;
+    for (int i = 0; i < N; ++i) {
+        int score = rand() % 101; // Random score between 0 and 100
+        index.insert(names[i], score);
+        rescan.insert(names[i], score);
+    }
+
+    long long checksumIndex = 0, checksumRescan = 0;
+
+    auto start = chrono::high_resolution_clock::now();
+    for (const Op &op : ops) {
+        if (op.type == QUERY) {
+            if (index.size() > 0)
+                checksumIndex += index.min().score * 1000 + index.max().score;
+        } else if (op.type == REMOVE) {
+            index.remove(names[op.id]);
+        } else {
+            index.insert(names[op.id], op.score);
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    double indexTime = chrono::duration<double>(end - start).count();
+
+    start = chrono::high_resolution_clock::now();
+    for (const Op &op : ops) {
+        if (op.type == QUERY) {
+            if (rescan.size() > 0) {
+                pair<int, int> mm = rescan.minMax();
+                checksumRescan += mm.first * 1000 + mm.second;
+            }
+        } else if (op.type == REMOVE) {
+            rescan.remove(names[op.id]);
+        } else {
+            rescan.insert(names[op.id], op.score);
+        }
+    }
+    end = chrono::high_resolution_clock::now();
+    double rescanTime = chrono::duration<double>(end - start).count();
+
+    cout << "Number of Participants: " << N << ", operations: " << opCount << "\n";
+    cout << "ScoreIndex: " << indexTime << " seconds\n";
+    cout << "Rescan per query: " << rescanTime << " seconds (" << rescanTime / indexTime << "x slower)\n";
+    if (checksumIndex != checksumRescan)
+        cout << "MISMATCH between ScoreIndex and rescan\n";
+    cout << "-----------------------------------------\n";
+}
+
+int main() {
+    srand(time(0)); // Seed for random number generation
+
+    // List of participant counts to test
+    vector<int> participantCounts = {1000, 10000, 100000};
+
+    for (int count : participantCounts) {
+        measureExecutionTime(count, 20000);
+    }
+
+    return 0;
+}
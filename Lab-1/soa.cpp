@@ -0,0 +1,278 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <ctime>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+struct Participant {
+    string name;
+    int score;
+};
+
+// Columnar participant store: scores live in one aligned int32 array so the
+// min/max scan only streams 4 bytes per record, names are packed into a pool
+class ParticipantTable {
+public:
+    ParticipantTable() : scores(nullptr), count(0), capacity(0) {}
+
+    ~ParticipantTable() {
+        free(scores);
+    }
+
+    ParticipantTable(const ParticipantTable &) = delete;
+    ParticipantTable &operator=(const ParticipantTable &) = delete;
+
+    void reserve(size_t n, size_t nameBytes = 0) {
+        if (n > capacity) {
+            // 64-byte alignment keeps every vector load on one cache line
+            size_t bytes = ((n * sizeof(int32_t) + 63) / 64) * 64;
+            int32_t *grown = static_cast<int32_t *>(aligned_alloc(64, bytes));
+            if (count > 0)
+                memcpy(grown, scores, count * sizeof(int32_t));
+            free(scores);
+            scores = grown;
+            capacity = n;
+        }
+        nameOffsets.reserve(n + 1);
+        namePool.reserve(nameBytes);
+    }
+
+    void add(string_view name, int32_t score) {
+        if (count == capacity)
+            reserve(capacity == 0 ? 16 : capacity * 2);
+        if (nameOffsets.empty())
+            nameOffsets.push_back(0);
+        namePool.append(name.data(), name.size());
+        nameOffsets.push_back(namePool.size());
+        scores[count++] = score;
+    }
+
+    size_t size() const { return count; }
+    const int32_t *scoreData() const { return scores; }
+    int32_t score(size_t i) const { return scores[i]; }
+
+    string_view name(size_t i) const {
+        return string_view(namePool.data() + nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+    }
+
+private:
+    int32_t *scores;
+    size_t count;
+    size_t capacity;
+    string namePool;
+    vector<size_t> nameOffsets;
+};
+
+struct MinMaxIndex {
+    size_t minIndex;
+    size_t maxIndex;
+};
+
+// Scalar kernel, same tie rule as minmax_element: first minimum, last maximum
+MinMaxIndex minMaxScalar(const int32_t *a, size_t n) {
+    MinMaxIndex r = {0, 0};
+    for (size_t i = 1; i < n; ++i) {
+        if (a[i] < a[r.minIndex])
+            r.minIndex = i;
+        if (a[i] >= a[r.maxIndex])
+            r.maxIndex = i;
+    }
+    return r;
+}
+
+// Folds a scalar tail [from, n) into an already reduced result
+void minMaxTail(const int32_t *a, size_t n, size_t from, MinMaxIndex &r) {
+    for (size_t i = from; i < n; ++i) {
+        if (a[i] < a[r.minIndex])
+            r.minIndex = i;
+        if (a[i] >= a[r.maxIndex])
+            r.maxIndex = i;
+    }
+}
+
+// Picks the winning lane: smallest value with the lowest index for the
+// minimum, largest value with the highest index for the maximum
+MinMaxIndex reduceLanes(const int32_t *minVal, const int32_t *minIdx,
+                        const int32_t *maxVal, const int32_t *maxIdx, int lanes) {
+    int bestMin = 0, bestMax = 0;
+    for (int l = 1; l < lanes; ++l) {
+        if (minVal[l] < minVal[bestMin] ||
+            (minVal[l] == minVal[bestMin] && minIdx[l] < minIdx[bestMin]))
+            bestMin = l;
+        if (maxVal[l] > maxVal[bestMax] ||
+            (maxVal[l] == maxVal[bestMax] && maxIdx[l] > maxIdx[bestMax]))
+            bestMax = l;
+    }
+    MinMaxIndex r = {(size_t)minIdx[bestMin], (size_t)maxIdx[bestMax]};
+    return r;
+}
+
+#if defined(__AVX2__)
+// AVX2 kernel: each lane tracks its own first-min / last-max and index,
+// lanes are reduced once at the end. Indices are int32, so n < 2^31.
+MinMaxIndex minMaxSimd(const int32_t *a, size_t n) {
+    if (n < 16)
+        return minMaxScalar(a, n);
+
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i vmin = _mm256_load_si256((const __m256i *)a);
+    __m256i vmax = vmin;
+    __m256i vminIdx = idx;
+    __m256i vmaxIdx = idx;
+
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        idx = _mm256_add_epi32(idx, step);
+        __m256i x = _mm256_load_si256((const __m256i *)(a + i));
+        __m256i lt = _mm256_cmpgt_epi32(vmin, x);   // x < min: strictly smaller
+        __m256i ge = _mm256_cmpgt_epi32(x, vmax);   // x > max
+        ge = _mm256_or_si256(ge, _mm256_cmpeq_epi32(x, vmax)); // or equal: later wins
+        vmin = _mm256_min_epi32(vmin, x);
+        vmax = _mm256_max_epi32(vmax, x);
+        vminIdx = _mm256_blendv_epi8(vminIdx, idx, lt);
+        vmaxIdx = _mm256_blendv_epi8(vmaxIdx, idx, ge);
+    }
+
+    alignas(32) int32_t minVal[8], minIdx[8], maxVal[8], maxIdx[8];
+    _mm256_store_si256((__m256i *)minVal, vmin);
+    _mm256_store_si256((__m256i *)minIdx, vminIdx);
+    _mm256_store_si256((__m256i *)maxVal, vmax);
+    _mm256_store_si256((__m256i *)maxIdx, vmaxIdx);
+
+    MinMaxIndex r = reduceLanes(minVal, minIdx, maxVal, maxIdx, 8);
+    minMaxTail(a, n, i, r);
+    return r;
+}
+const char *simdName = "AVX2";
+#elif defined(__SSE4_1__)
+// SSE4.1 kernel, 4 lanes, same scheme as the AVX2 one
+MinMaxIndex minMaxSimd(const int32_t *a, size_t n) {
+    if (n < 8)
+        return minMaxScalar(a, n);
+
+    __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step = _mm_set1_epi32(4);
+    __m128i vmin = _mm_load_si128((const __m128i *)a);
+    __m128i vmax = vmin;
+    __m128i vminIdx = idx;
+    __m128i vmaxIdx = idx;
+
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        idx = _mm_add_epi32(idx, step);
+        __m128i x = _mm_load_si128((const __m128i *)(a + i));
+        __m128i lt = _mm_cmplt_epi32(x, vmin);
+        __m128i ge = _mm_or_si128(_mm_cmpgt_epi32(x, vmax), _mm_cmpeq_epi32(x, vmax));
+        vmin = _mm_min_epi32(vmin, x);
+        vmax = _mm_max_epi32(vmax, x);
+        vminIdx = _mm_blendv_epi8(vminIdx, idx, lt);
+        vmaxIdx = _mm_blendv_epi8(vmaxIdx, idx, ge);
+    }
+
+    alignas(16) int32_t minVal[4], minIdx[4], maxVal[4], maxIdx[4];
+    _mm_store_si128((__m128i *)minVal, vmin);
+    _mm_store_si128((__m128i *)minIdx, vminIdx);
+    _mm_store_si128((__m128i *)maxVal, vmax);
+    _mm_store_si128((__m128i *)maxIdx, vmaxIdx);
+
+    MinMaxIndex r = reduceLanes(minVal, minIdx, maxVal, maxIdx, 4);
+    minMaxTail(a, n, i, r);
+    return r;
+}
+const char *simdName = "SSE4.1";
+#else
+MinMaxIndex minMaxSimd(const int32_t *a, size_t n) {
+    return minMaxScalar(a, n);
+}
+const char *simdName = "scalar";
+#endif
+
+MinMaxIndex minMax(const ParticipantTable &table) {
+    return minMaxSimd(table.scoreData(), table.size());
+}
+
+void measureExecutionTime(int N) {
+    vector<Participant> participants(N);
+    ParticipantTable table;
+    table.reserve(N, (size_t)N * 16);
+
+    // Generate random data, same records in both layouts
+    for (int i = 0; i < N; ++i) {
+        participants[i].name = "Participant" + to_string(i + 1);
+        participants[i].score = rand() % 101; // Random score between 0 and 100
+        table.add(participants[i].name, participants[i].score);
+    }
+
+    // Repeat small scans so the clock has something to measure
+    int reps = max(1, 10000000 / N);
+
+    // AoS path, as in time.cpp
+    auto start = chrono::high_resolution_clock::now();
+    size_t aosMin = 0, aosMax = 0;
+    for (int r = 0; r < reps; ++r) {
+        auto minMaxParticipant = minmax_element(
+            participants.begin(), participants.end(),
+            [](const Participant &p1, const Participant &p2) {
+                return p1.score < p2.score;
+            });
+        aosMin = minMaxParticipant.first - participants.begin();
+        aosMax = minMaxParticipant.second - participants.begin();
+    }
+    auto end = chrono::high_resolution_clock::now();
+    double aosTime = chrono::duration<double>(end - start).count() / reps;
+
+    // SoA path, scalar kernel
+    start = chrono::high_resolution_clock::now();
+    MinMaxIndex scalar = {0, 0};
+    for (int r = 0; r < reps; ++r)
+        scalar = minMaxScalar(table.scoreData(), table.size());
+    end = chrono::high_resolution_clock::now();
+    double scalarTime = chrono::duration<double>(end - start).count() / reps;
+
+    // SoA path, vector kernel
+    start = chrono::high_resolution_clock::now();
+    MinMaxIndex simd = {0, 0};
+    for (int r = 0; r < reps; ++r)
+        simd = minMax(table);
+    end = chrono::high_resolution_clock::now();
+    double simdTime = chrono::duration<double>(end - start).count() / reps;
+
+    bool match = scalar.minIndex == aosMin && scalar.maxIndex == aosMax &&
+                 simd.minIndex == aosMin && simd.maxIndex == aosMax;
+
+    cout << "Number of Participants: " << N << "\n";
+    cout << "AoS minmax_element: " << aosTime << " seconds\n";
+    cout << "SoA scalar: " << scalarTime << " seconds (" << aosTime / scalarTime << "x)\n";
+    cout << "SoA " << simdName << ": " << simdTime << " seconds (" << aosTime / simdTime << "x)\n";
+    cout << "Minimum mark participant: " << table.name(simd.minIndex) << " with score " << table.score(simd.minIndex) << "\n";
+    cout << "Maximum mark participant: " << table.name(simd.maxIndex) << " with score " << table.score(simd.maxIndex) << "\n";
+    if (!match)
+        cout << "MISMATCH against minmax_element\n";
+    cout << "-----------------------------------------\n";
+}
+
+int main() {
+    srand(time(0)); // Seed for random number generation
+
+    // List of participant counts to test
+    vector<int> participantCounts = {10, 100, 1000, 10000, 100000, 1000000, 10000000};
+
+    for (int count : participantCounts) {
+        measureExecutionTime(count);
+    }
+
+    return 0;
+}
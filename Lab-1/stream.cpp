@@ -0,0 +1,188 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Running min/max over a stream of "name score" lines. Only the current
+// minimum and maximum names are kept, so memory does not grow with input.
+struct RunningMinMax {
+    string minName, maxName;
+    long long minScore = 0, maxScore = 0;
+    long long count = 0;
+
+    // Same tie rule as minmax_element: first minimum, last maximum
+    void add(const char *name, size_t len, long long score) {
+        if (count == 0 || score < minScore) {
+            minScore = score;
+            minName.assign(name, len);
+        }
+        if (count == 0 || score >= maxScore) {
+            maxScore = score;
+            maxName.assign(name, len);
+        }
+        ++count;
+    }
+};
+
+// Parses an optionally signed decimal integer starting at p, stops at end or
+// the first non-digit. Returns false if no digits were found or the value
+// does not fit in a long long.
+bool parseInt(const char *&p, const char *end, long long &value) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    const char *digits = p;
+    // Magnitude limit: |LLONG_MIN| = LLONG_MAX + 1 for negative values
+    unsigned long long limit = (unsigned long long)LLONG_MAX + negative;
+    unsigned long long v = 0;
+    while (p < end && (unsigned)(*p - '0') < 10) {
+        unsigned d = *p - '0';
+        if (v > (limit - d) / 10)
+            return false;
+        v = v * 10 + d;
+        ++p;
+    }
+    value = negative ? (long long)(0 - v) : (long long)v;
+    return p != digits;
+}
+
+// Handles one line; malformed lines (no name, no score, a score out of
+// range or anything but blanks after it) are counted and skipped
+void parseLine(const char *p, const char *end, RunningMinMax &result, long long &skipped) {
+    while (p < end && (*p == ' ' || *p == '\t'))
+        ++p;
+    const char *name = p;
+    while (p < end && *p != ' ' && *p != '\t')
+        ++p;
+    size_t nameLen = p - name;
+    while (p < end && (*p == ' ' || *p == '\t'))
+        ++p;
+
+    long long score;
+    if (nameLen == 0 || !parseInt(p, end, score)) {
+        if (nameLen != 0 || p != end)
+            ++skipped;
+        return;
+    }
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        ++p;
+    if (p != end) {
+        ++skipped;
+        return;
+    }
+    result.add(name, nameLen, score);
+}
+
+// Reads fd in large blocks and parses complete lines in place. A partial
+// line at the end of a block is moved to the front before the next read.
+bool ingest(int fd, RunningMinMax &result, long long &skipped, long long &bytes) {
+    const size_t bufferSize = 1 << 20;
+    char *buffer = new char[bufferSize];
+    size_t filled = 0;
+
+    for (;;) {
+        ssize_t got = read(fd, buffer + filled, bufferSize - filled);
+        if (got < 0) {
+            perror("read");
+            delete[] buffer;
+            return false;
+        }
+        bytes += got;
+        filled += got;
+        bool eof = got == 0;
+
+        const char *p = buffer;
+        const char *end = buffer + filled;
+        for (;;) {
+            const char *nl = (const char *)memchr(p, '\n', end - p);
+            if (!nl)
+                break;
+            const char *lineEnd = nl;
+            if (lineEnd > p && lineEnd[-1] == '\r')
+                --lineEnd;
+            parseLine(p, lineEnd, result, skipped);
+            p = nl + 1;
+        }
+
+        size_t rest = end - p;
+        if (eof) {
+            if (rest > 0)
+                parseLine(p, end, result, skipped);
+            break;
+        }
+        if (rest == bufferSize) {
+            cerr << "Line longer than " << bufferSize << " bytes\n";
+            delete[] buffer;
+            return false;
+        }
+        memmove(buffer, p, rest);
+        filled = rest;
+    }
+
+    delete[] buffer;
+    return true;
+}
+
+// Writes N random "ParticipantI score" lines, handy for producing test dumps
+void generate(long long N) {
+    srand(time(0));
+    for (long long i = 0; i < N; ++i)
+        printf("Participant%lld %d\n", i + 1, rand() % 101);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 3 && strcmp(argv[1], "--generate") == 0) {
+        generate(atoll(argv[2]));
+        return 0;
+    }
+
+    // Reads from the file given on the command line, or stdin without one
+    int fd = 0;
+    if (argc > 1 && strcmp(argv[1], "-") != 0) {
+        fd = open(argv[1], O_RDONLY);
+        if (fd < 0) {
+            perror(argv[1]);
+            return 1;
+        }
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+
+    RunningMinMax result;
+    long long skipped = 0, bytes = 0;
+
+    auto start = chrono::high_resolution_clock::now();
+    bool ok = ingest(fd, result, skipped, bytes);
+    auto end = chrono::high_resolution_clock::now();
+    double duration = chrono::duration<double>(end - start).count();
+
+    if (fd != 0)
+        close(fd);
+    if (!ok)
+        return 1;
+
+    cout << "Participants read: " << result.count << "\n";
+    if (skipped > 0)
+        cout << "Malformed lines skipped: " << skipped << "\n";
+    cout << "Time taken to execute: " << duration << " seconds";
+    if (duration > 0)
+        cout << " (" << bytes / duration / (1 << 20) << " MB/s)";
+    cout << "\n";
+    if (result.count == 0)
+        return 0;
+    cout << "Minimum mark participant: " << result.minName << " with score " << result.minScore << "\n";
+    cout << "Maximum mark participant: " << result.maxName << " with score " << result.maxScore << "\n";
+
+    return 0;
+}
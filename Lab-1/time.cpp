@@ -4,6 +4,16 @@
 #include <limits>
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <queue>
+#include <memory>
 
 using namespace std;
 
@@ -12,46 +22,203 @@ struct Participant {
     int score;
 };
 
-void measureExecutionTime(int N) {
-    vector<Participant> participants(N);
+// Fixed-size pool of worker threads fed from one task queue
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads) : stopping(false) {
+        for (int i = 0; i < threads; ++i)
+            workers.emplace_back([this] { run(); });
+    }
 
-    // Generate random data
-    for (int i = 0; i < N; ++i) {
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (thread &w : workers)
+            w.join();
+    }
+
+    int size() const { return workers.size(); }
+
+    future<void> submit(function<void()> task) {
+        auto job = make_shared<packaged_task<void()>>(move(task));
+        future<void> done = job->get_future();
+        {
+            lock_guard<mutex> lock(m);
+            tasks.push([job] { (*job)(); });
+        }
+        cv.notify_one();
+        return done;
+    }
+
+private:
+    void run() {
+        for (;;) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(m);
+                cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty())
+                    return;
+                task = move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    vector<thread> workers;
+    queue<function<void()>> tasks;
+    mutex m;
+    condition_variable cv;
+    bool stopping;
+};
+
+// Parallel min/max: each chunk is reduced with minmax_element, then chunks
+// are merged left to right. A later chunk only replaces the minimum when it
+// is strictly smaller and replaces the maximum when it is greater or equal,
+// so the result is the first minimum and last maximum, like minmax_element.
+pair<size_t, size_t> parallelMinMax(const vector<Participant> &participants, ThreadPool &pool) {
+    size_t n = participants.size();
+    size_t chunks = min<size_t>(pool.size(), max<size_t>(n, 1));
+    vector<pair<size_t, size_t>> partial(chunks);
+    vector<future<void>> pending;
+
+    for (size_t c = 0; c < chunks; ++c) {
+        size_t lo = n * c / chunks;
+        size_t hi = n * (c + 1) / chunks;
+        pending.push_back(pool.submit([&participants, &partial, c, lo, hi] {
+            auto first = participants.begin() + lo;
+            auto last = participants.begin() + hi;
+            auto mm = minmax_element(first, last,
+                [](const Participant &p1, const Participant &p2) {
+                    return p1.score < p2.score;
+                });
+            partial[c] = {(size_t)(mm.first - participants.begin()),
+                          (size_t)(mm.second - participants.begin())};
+        }));
+    }
+    for (future<void> &f : pending)
+        f.get();
+
+    pair<size_t, size_t> best = partial[0];
+    for (size_t c = 1; c < chunks; ++c) {
+        if (participants[partial[c].first].score < participants[best.first].score)
+            best.first = partial[c].first;
+        if (participants[partial[c].second].score >= participants[best.second].score)
+            best.second = partial[c].second;
+    }
+    return best;
+}
+
+void generateParticipants(vector<Participant> &participants) {
+    for (size_t i = 0; i < participants.size(); ++i) {
         participants[i].name = "Participant" + to_string(i + 1);
         participants[i].score = rand() % 101; // Random score between 0 and 100
     }
+}
+
+void measureExecutionTime(int N, ThreadPool *pool) {
+    vector<Participant> participants(N);
+
+    // Generate random data
+    generateParticipants(participants);
 
     // Timing the execution
     clock_t start = clock();
+    auto wallStart = chrono::high_resolution_clock::now();
 
-    auto minMaxParticipant = minmax_element(
-        participants.begin(), participants.end(),
-        [](const Participant &p1, const Participant &p2) {
-            return p1.score < p2.score;
-        });
+    // Keep indices rather than copying the winning records
+    pair<size_t, size_t> minMaxIndex;
+    if (pool) {
+        minMaxIndex = parallelMinMax(participants, *pool);
+    } else {
+        auto minMaxParticipant = minmax_element(
+            participants.begin(), participants.end(),
+            [](const Participant &p1, const Participant &p2) {
+                return p1.score < p2.score;
+            });
 
-    Participant minParticipant = *minMaxParticipant.first;
-    Participant maxParticipant = *minMaxParticipant.second;
+        minMaxIndex.first = minMaxParticipant.first - participants.begin();
+        minMaxIndex.second = minMaxParticipant.second - participants.begin();
+    }
+    const Participant &minParticipant = participants[minMaxIndex.first];
+    const Participant &maxParticipant = participants[minMaxIndex.second];
 
-    // Calculate execution time
+    // Calculate execution time; clock() adds up CPU time of every thread,
+    // so the parallel mode reports wall time instead
     double duration = (clock() - start) / (double)CLOCKS_PER_SEC;
+    if (pool)
+        duration = chrono::duration<double>(chrono::high_resolution_clock::now() - wallStart).count();
 
     cout << "Number of Participants: " << N << "\n";
+    if (pool)
+        cout << "Threads: " << pool->size() << "\n";
     cout << "Time taken to execute: " << duration << " seconds\n";
     cout << "Minimum mark participant: " << minParticipant.name << " with score " << minParticipant.score << "\n";
     cout << "Maximum mark participant: " << maxParticipant.name << " with score " << maxParticipant.score << "\n";
     cout << "-----------------------------------------\n";
 }
 
-int main() {
+// Wall time of the parallel reduction for 1..maxThreads threads on one data set
+void printScalingTable(int N, int maxThreads) {
+    vector<Participant> participants(N);
+    generateParticipants(participants);
+
+    auto expected = minmax_element(
+        participants.begin(), participants.end(),
+        [](const Participant &p1, const Participant &p2) {
+            return p1.score < p2.score;
+        });
+    size_t expectedMin = expected.first - participants.begin();
+    size_t expectedMax = expected.second - participants.begin();
+
+    cout << "Scaling for " << N << " participants\n";
+    cout << "Threads\tTime (s)\tSpeedup\tSame result\n";
+    double base = 0;
+    for (int t = 1; t <= maxThreads; ++t) {
+        ThreadPool pool(t);
+        const int reps = 5;
+        double best = 1e30;
+        pair<size_t, size_t> result;
+        for (int r = 0; r < reps; ++r) {
+            auto start = chrono::high_resolution_clock::now();
+            result = parallelMinMax(participants, pool);
+            auto end = chrono::high_resolution_clock::now();
+            best = min(best, chrono::duration<double>(end - start).count());
+        }
+        if (t == 1)
+            base = best;
+        bool same = result.first == expectedMin && result.second == expectedMax;
+        cout << t << "\t" << best << "\t" << base / best << "\t" << (same ? "yes" : "no") << "\n";
+    }
+}
+
+int main(int argc, char *argv[]) {
     srand(time(0)); // Seed for random number generation
 
+    // --threads N switches to the parallel reduction and adds a scaling table
+    int threads = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+    }
+
     // List of participant counts to test
     vector<int> participantCounts = {10, 100, 1000, 10000, 100000};
 
+    unique_ptr<ThreadPool> pool;
+    if (threads > 0)
+        pool.reset(new ThreadPool(threads));
+
     for (int count : participantCounts) {
-        measureExecutionTime(count);
+        measureExecutionTime(count, pool.get());
     }
 
+    if (threads > 0)
+        printScalingTable(10000000, threads);
+
     return 0;
 }
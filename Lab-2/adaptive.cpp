@@ -0,0 +1,239 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <algorithm>
+using namespace std;
+
+void InsertionSort(int arr[], int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j = j - 1;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+const int MIN_RUN = 32;      // shorter runs are extended with insertion sort
+const int SMALL_PART = 16;   // partitions this small go to insertion sort
+
+// Length of the run starting at lo. A strictly descending run is reversed
+// in place (strict, so equal keys never swap order).
+int findRun(int arr[], int lo, int n) {
+    int hi = lo + 1;
+    if (hi == n)
+        return 1;
+    if (arr[hi] < arr[lo]) {
+        while (hi + 1 < n && arr[hi + 1] < arr[hi])
+            ++hi;
+        reverse(arr + lo, arr + hi + 1);
+    } else {
+        while (hi + 1 < n && arr[hi + 1] >= arr[hi])
+            ++hi;
+    }
+    return hi - lo + 1;
+}
+
+// Counts natural runs without touching the array
+int countRuns(const int arr[], int n) {
+    int runs = 0;
+    for (int i = 0; i < n;) {
+        int j = i + 1;
+        if (j < n && arr[j] < arr[i]) {
+            while (j < n && arr[j] < arr[j - 1])
+                ++j;
+        } else {
+            while (j < n && arr[j] >= arr[j - 1])
+                ++j;
+        }
+        ++runs;
+        i = j;
+    }
+    return runs;
+}
+
+// Merges arr[l..m) and arr[m..r) through buf
+void mergeRuns(int arr[], int l, int m, int r, int buf[]) {
+    if (arr[m - 1] <= arr[m])
+        return; // already in order, common on presorted input
+    copy(arr + l, arr + m, buf);
+    int i = 0, j = m, k = l, n1 = m - l;
+    while (i < n1 && j < r) {
+        if (buf[i] <= arr[j])
+            arr[k++] = buf[i++];
+        else
+            arr[k++] = arr[j++];
+    }
+    while (i < n1)
+        arr[k++] = buf[i++];
+}
+
+// Run-merging path: natural runs, short ones padded to MIN_RUN with
+// insertion sort, then adjacent runs merged pairwise until one is left
+void runMergeSort(int arr[], int n) {
+    vector<int> bounds = {0};
+    for (int lo = 0; lo < n;) {
+        int len = findRun(arr, lo, n);
+        if (len < MIN_RUN) {
+            len = min(MIN_RUN, n - lo);
+            InsertionSort(arr + lo, len);
+        }
+        lo += len;
+        bounds.push_back(lo);
+    }
+
+    vector<int> buf(n / 2 + 1);
+    while (bounds.size() > 2) {
+        vector<int> next = {0};
+        for (size_t i = 0; i + 2 < bounds.size(); i += 2) {
+            int l = bounds[i], m = bounds[i + 1], r = bounds[i + 2];
+            if ((size_t)(m - l) > buf.size())
+                buf.resize(m - l);
+            mergeRuns(arr, l, m, r, buf.data());
+            next.push_back(r);
+        }
+        if (bounds.size() % 2 == 0)
+            next.push_back(bounds.back());
+        bounds.swap(next);
+    }
+}
+
+int medianOfThree(int a, int b, int c) {
+    return max(min(a, b), min(max(a, b), c));
+}
+
+// Quicksort with three-way (Dijkstra) partitioning: keys equal to the pivot
+// are gathered in the middle and never touched again, so input with few
+// distinct keys finishes in O(n log k). Falls back to heapsort if the
+// recursion gets too deep.
+void threeWayQuickSort(int arr[], int lo, int hi, int depth) {
+    while (hi - lo > SMALL_PART) {
+        if (depth-- == 0) {
+            make_heap(arr + lo, arr + hi + 1);
+            sort_heap(arr + lo, arr + hi + 1);
+            return;
+        }
+        int pivot = medianOfThree(arr[lo], arr[lo + (hi - lo) / 2], arr[hi]);
+        int lt = lo, i = lo, gt = hi;
+        while (i <= gt) {
+            if (arr[i] < pivot)
+                swap(arr[lt++], arr[i++]);
+            else if (arr[i] > pivot)
+                swap(arr[i], arr[gt--]);
+            else
+                ++i;
+        }
+        // Recurse into the smaller side, loop on the larger one
+        if (lt - lo < hi - gt) {
+            threeWayQuickSort(arr, lo, lt - 1, depth);
+            lo = gt + 1;
+        } else {
+            threeWayQuickSort(arr, gt + 1, hi, depth);
+            hi = lt - 1;
+        }
+    }
+    InsertionSort(arr + lo, hi - lo + 1);
+}
+
+// Picks a strategy from one O(n) scan: few long runs means presorted data
+// and goes to run merging, otherwise three-way quicksort
+void AdaptiveSort(int arr[], int n) {
+    if (n <= SMALL_PART) {
+        InsertionSort(arr, n);
+        return;
+    }
+    if (countRuns(arr, n) <= n / MIN_RUN) {
+        runMergeSort(arr, n);
+    } else {
+        int depth = 0;
+        for (int m = n; m > 1; m /= 2)
+            depth += 2;
+        threeWayQuickSort(arr, 0, n - 1, depth);
+    }
+}
+
+void generate(vector<int> &arr, const string &kind) {
+    int n = arr.size();
+    for (int i = 0; i < n; ++i) {
+        arr[i] = rand() % 100; // same distribution as time.cpp: 100 distinct keys
+    }
+    if (kind == "random-wide") {
+        for (int i = 0; i < n; ++i)
+            arr[i] = rand();
+    } else if (kind == "sorted") {
+        sort(arr.begin(), arr.end());
+    } else if (kind == "reversed") {
+        sort(arr.begin(), arr.end(), greater<int>());
+    } else if (kind == "nearly-sorted") {
+        // Sorted, then 1% of the elements swapped with a close neighbour
+        for (int i = 0; i < n; ++i)
+            arr[i] = rand();
+        sort(arr.begin(), arr.end());
+        for (int k = 0; k < n / 100 + 1 && n > 1; ++k) {
+            int i = rand() % n;
+            int j = min(n - 1, i + 1 + rand() % 8);
+            swap(arr[i], arr[j]);
+        }
+    } else if (kind == "runs") {
+        // Alternating ascending and descending runs of 100..10000 elements
+        for (int i = 0; i < n;) {
+            int len = min(n - i, 100 + rand() % 9901);
+            sort(arr.begin() + i, arr.begin() + i + len);
+            if (rand() % 2)
+                reverse(arr.begin() + i, arr.begin() + i + len);
+            i += len;
+        }
+    } else if (kind == "few-unique") {
+        for (int i = 0; i < n; ++i)
+            arr[i] = rand() % 4;
+    }
+}
+
+double timeSort(void (*sortFn)(int[], int), const vector<int> &input, const vector<int> &expected) {
+    vector<int> arr = input;
+    clock_t start = clock();
+    sortFn(arr.data(), arr.size());
+    clock_t end = clock();
+    if (arr != expected)
+        cout << "MISMATCH: output not sorted" << endl;
+    return double(end - start) / CLOCKS_PER_SEC;
+}
+
+void stdSort(int arr[], int n) {
+    sort(arr, arr + n);
+}
+
+void measureExecutionTime(int n, const string &kind, int insertionLimit) {
+    vector<int> input(n);
+    generate(input, kind);
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end());
+
+    double adaptive = timeSort(AdaptiveSort, input, expected);
+    double reference = timeSort(stdSort, input, expected);
+
+    cout << "Input: " << kind << ", size: " << n
+         << ", Adaptive: " << adaptive << " s, std::sort: " << reference << " s";
+    // Insertion sort is only run where it finishes in reasonable time
+    bool presorted = kind == "sorted" || kind == "nearly-sorted";
+    if (n <= insertionLimit || presorted)
+        cout << ", Insertion: " << timeSort(InsertionSort, input, expected) << " s";
+    cout << endl;
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    int insertionLimit = argc > 1 ? atoi(argv[1]) : 100000;
+    int sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+    string kinds[] = {"random", "random-wide", "sorted", "reversed", "nearly-sorted", "runs", "few-unique"};
+    for (const string &kind : kinds) {
+        for (int size : sizes) {
+            measureExecutionTime(size, kind, insertionLimit);
+        }
+    }
+    return 0;
+}
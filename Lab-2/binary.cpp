@@ -0,0 +1,132 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+using namespace std;
+
+void InsertionSort(int arr[], int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j = j - 1;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// First position in arr[0..n) holding a value greater than key. The loop
+// has a fixed trip count and the select compiles to cmov, so it does not
+// mispredict on random data.
+int upperBound(const int arr[], int n, int key) {
+    if (n == 0)
+        return 0;
+    const int *base = arr;
+    while (n > 1) {
+        int half = n / 2;
+        base = (base[half] <= key) ? base + half : base;
+        n -= half;
+    }
+    return (base - arr) + (*base <= key);
+}
+
+// Binary search for the slot, then shift the tail with one memmove.
+// Inserting after equal keys keeps the sort stable.
+void BinaryInsertionSort(int arr[], int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = arr[i];
+        int pos = upperBound(arr, i, key);
+        memmove(arr + pos + 1, arr + pos, (i - pos) * sizeof(int));
+        arr[pos] = key;
+    }
+}
+
+// Gallops left from the end of the sorted prefix in steps of 1, 2, 4, ...
+// and binary searches only the last step, so an element that belongs d
+// places back costs O(log d) compares instead of O(log i).
+void GallopingInsertionSort(int arr[], int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = arr[i];
+        if (arr[i - 1] <= key)
+            continue;
+
+        int hi = i - 1; // arr[hi] > key
+        int step = 1;
+        int lo = hi - step;
+        while (lo >= 0 && arr[lo] > key) {
+            hi = lo;
+            step *= 2;
+            lo = hi - step;
+        }
+        lo = max(lo + 1, 0);
+        int pos = lo + upperBound(arr + lo, hi - lo, key);
+        memmove(arr + pos + 1, arr + pos, (i - pos) * sizeof(int));
+        arr[pos] = key;
+    }
+}
+
+void generate(vector<int> &arr, const string &kind) {
+    int n = arr.size();
+    for (int i = 0; i < n; ++i) {
+        arr[i] = rand() % 100;
+    }
+    if (kind == "sorted") {
+        sort(arr.begin(), arr.end());
+    } else if (kind == "reversed") {
+        sort(arr.begin(), arr.end(), greater<int>());
+    } else if (kind == "nearly-sorted") {
+        // Sorted, then 1% of the elements swapped with a close neighbour
+        sort(arr.begin(), arr.end());
+        for (int k = 0; k < n / 100 + 1 && n > 1; ++k) {
+            int i = rand() % n;
+            int j = min(n - 1, i + 1 + rand() % 8);
+            swap(arr[i], arr[j]);
+        }
+    }
+}
+
+double timeSort(void (*sortFn)(int[], int), const vector<int> &input, const vector<int> &expected) {
+    vector<int> arr = input;
+    clock_t start = clock();
+    sortFn(arr.data(), arr.size());
+    clock_t end = clock();
+    if (arr != expected)
+        cout << "MISMATCH: output not sorted" << endl;
+    return double(end - start) / CLOCKS_PER_SEC;
+}
+
+void measureExecutionTime(int n, const string &kind) {
+    vector<int> input(n);
+    generate(input, kind);
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end());
+
+    double linear = timeSort(InsertionSort, input, expected);
+    double binary = timeSort(BinaryInsertionSort, input, expected);
+    double galloping = timeSort(GallopingInsertionSort, input, expected);
+
+    cout << "Input: " << kind << ", size: " << n
+         << ", Insertion: " << linear
+         << " s, Binary: " << binary
+         << " s, Galloping: " << galloping << " s" << endl;
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    // The 10^6 entry takes minutes with the quadratic sorts, so the sweep
+    // stops at 10^5 unless a larger limit is given on the command line
+    int maxSize = argc > 1 ? atoi(argv[1]) : 100000;
+    int sizes[] = {10, 100, 1000, 10000, 100000, 1000000};
+    string kinds[] = {"random", "sorted", "reversed", "nearly-sorted"};
+    for (const string &kind : kinds) {
+        for (int size : sizes) {
+            if (size <= maxSize)
+                measureExecutionTime(size, kind);
+        }
+    }
+    return 0;
+}
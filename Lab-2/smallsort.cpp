@@ -0,0 +1,235 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+void InsertionSort(int arr[], int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j = j - 1;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+#ifdef __AVX2__
+// Compare-exchange of every lane with the lane chosen by perm; lanes whose
+// bit is set in Mask keep the larger value.
+template <int Mask>
+inline __m256i exchange(__m256i v, __m256i perm) {
+    __m256i p = _mm256_permutevar8x32_epi32(v, perm);
+    return _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), Mask);
+}
+
+inline __m256i reverse8(__m256i v) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+// Sorts the 8 lanes of one register: bitonic network, 6 layers
+inline __m256i sort8(__m256i v) {
+    const __m256i swap1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+    v = exchange<0xAA>(v, swap1);
+    v = exchange<0xCC>(v, _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4));
+    v = exchange<0xAA>(v, swap1);
+    v = exchange<0xF0>(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v = exchange<0xCC>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    v = exchange<0xAA>(v, swap1);
+    return v;
+}
+
+// Sorts a bitonic register with half-cleaners at lane distance 4, 2, 1
+inline __m256i clean8(__m256i v) {
+    v = exchange<0xF0>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+    v = exchange<0xCC>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    v = exchange<0xAA>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+    return v;
+}
+
+// Merges two sorted runs of M registers each, r[0..M) and r[M..2M).
+// Comparing the first run with the mirrored second run splits them into two
+// bitonic halves with every element of the low half <= the high half; each
+// half is then cleaned register-wise and finally inside each register.
+template <int M>
+inline void mergeRuns(__m256i *r) {
+    for (int i = 0; i < M / 2; ++i) {
+        __m256i t = reverse8(r[M + i]);
+        r[M + i] = reverse8(r[2 * M - 1 - i]);
+        r[2 * M - 1 - i] = t;
+    }
+    if (M % 2 == 1)
+        r[M + M / 2] = reverse8(r[M + M / 2]);
+    for (int i = 0; i < M; ++i) {
+        __m256i lo = _mm256_min_epi32(r[i], r[M + i]);
+        __m256i hi = _mm256_max_epi32(r[i], r[M + i]);
+        r[i] = lo;
+        r[M + i] = hi;
+    }
+    for (int half = 0; half < 2; ++half) {
+        __m256i *h = r + half * M;
+        for (int d = M / 2; d >= 1; d /= 2) {
+            for (int i = 0; i < M; ++i) {
+                if (i & d)
+                    continue;
+                __m256i lo = _mm256_min_epi32(h[i], h[i + d]);
+                __m256i hi = _mm256_max_epi32(h[i], h[i + d]);
+                h[i] = lo;
+                h[i + d] = hi;
+            }
+        }
+        for (int i = 0; i < M; ++i)
+            h[i] = clean8(h[i]);
+    }
+}
+
+// Sorting network for 8 * Regs ints held in Regs registers
+template <int Regs>
+void sortNetwork(int *a) {
+    __m256i r[Regs];
+    for (int i = 0; i < Regs; ++i)
+        r[i] = sort8(_mm256_loadu_si256((const __m256i *)(a + 8 * i)));
+    if (Regs >= 2)
+        for (int i = 0; i < Regs; i += 2)
+            mergeRuns<1>(r + i);
+    if (Regs >= 4)
+        for (int i = 0; i < Regs; i += 4)
+            mergeRuns<2>(r + i);
+    if (Regs >= 8)
+        mergeRuns<4>(r);
+    for (int i = 0; i < Regs; ++i)
+        _mm256_storeu_si256((__m256i *)(a + 8 * i), r[i]);
+}
+const char *networkName = "AVX2";
+#else
+inline void compareExchange(int *a, int i, int j) {
+    int lo = min(a[i], a[j]);
+    int hi = max(a[i], a[j]);
+    a[i] = lo;
+    a[j] = hi;
+}
+
+// Scalar fallback: the same bitonic network, one compare-exchange at a time
+template <int Regs>
+void sortNetwork(int *a) {
+    const int n = 8 * Regs;
+    for (int k = 2; k <= n; k *= 2) {
+        for (int i = 0; i < n; i += k)
+            for (int j = 0; j < k / 2; ++j)
+                compareExchange(a, i + j, i + k - 1 - j);
+        for (int d = k / 4; d >= 1; d /= 2)
+            for (int i = 0; i < n; i += 2 * d)
+                for (int j = i; j < i + d; ++j)
+                    compareExchange(a, j, j + d);
+    }
+}
+const char *networkName = "scalar";
+#endif
+
+// Sorts up to 64 ints in a fixed network; n is padded with INT_MAX up to
+// the next of 8/16/32/64 so the padding ends up at the back.
+void networkSort(int *a, int n) {
+    alignas(32) int buf[64];
+    int size = n <= 8 ? 8 : n <= 16 ? 16 : n <= 32 ? 32 : 64;
+    memcpy(buf, a, n * sizeof(int));
+    for (int i = n; i < size; ++i)
+        buf[i] = INT_MAX;
+    switch (size) {
+    case 8: sortNetwork<1>(buf); break;
+    case 16: sortNetwork<2>(buf); break;
+    case 32: sortNetwork<4>(buf); break;
+    default: sortNetwork<8>(buf); break;
+    }
+    memcpy(a, buf, n * sizeof(int));
+}
+
+// Drop-in for InsertionSort: one network for n <= 64, otherwise 64-element
+// blocks sorted by the network and merged bottom-up through a scratch buffer
+void small_sort(int *a, int n) {
+    if (n <= 1)
+        return;
+    if (n <= 64) {
+        networkSort(a, n);
+        return;
+    }
+    for (int i = 0; i < n; i += 64)
+        networkSort(a + i, min(64, n - i));
+    vector<int> scratch(n);
+    int *src = a, *dst = scratch.data();
+    for (int width = 64; width < n; width *= 2) {
+        for (int lo = 0; lo < n; lo += 2 * width) {
+            int mid = min(lo + width, n), hi = min(lo + 2 * width, n);
+            merge(src + lo, src + mid, src + mid, src + hi, dst + lo);
+        }
+        swap(src, dst);
+    }
+    if (src != a)
+        memcpy(a, src, n * sizeof(int));
+}
+
+// Average time per sort over many small random arrays
+double timePerSort(void (*sortFn)(int *, int), const vector<int> &pool, int n, int reps) {
+    alignas(32) int work[64];
+    size_t offsets = pool.size() - n;
+    auto start = chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        memcpy(work, pool.data() + (r * 61) % offsets, n * sizeof(int));
+        sortFn(work, n);
+    }
+    auto end = chrono::high_resolution_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / reps;
+}
+
+void stdSort(int *a, int n) {
+    sort(a, a + n);
+}
+
+void insertionSort(int *a, int n) {
+    InsertionSort(a, n);
+}
+
+int main() {
+    srand(time(0));
+    vector<int> pool(1 << 16);
+    for (int &x : pool)
+        x = rand();
+
+    // Correctness against std::sort, including duplicates and n > 64
+    for (int n = 0; n <= 300; ++n) {
+        for (int trial = 0; trial < 20; ++trial) {
+            vector<int> a(n), b;
+            for (int &x : a)
+                x = trial % 2 ? rand() % 10 : rand() - RAND_MAX / 2;
+            b = a;
+            small_sort(a.data(), n);
+            sort(b.begin(), b.end());
+            if (a != b) {
+                cout << "MISMATCH at n = " << n << endl;
+                return 1;
+            }
+        }
+    }
+
+    cout << "Network kernel: " << networkName << endl;
+    cout << "n\tInsertionSort (ns)\tsmall_sort (ns)\tstd::sort (ns)" << endl;
+    int sizes[] = {4, 8, 12, 16, 24, 32, 48, 64};
+    const int reps = 1000000;
+    for (int n : sizes) {
+        double ins = timePerSort(insertionSort, pool, n, reps);
+        double net = timePerSort(small_sort, pool, n, reps);
+        double ref = timePerSort(stdSort, pool, n, reps);
+        cout << n << "\t" << ins << "\t\t\t" << net << "\t\t" << ref << endl;
+    }
+    return 0;
+}
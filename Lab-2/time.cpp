@@ -1,6 +1,8 @@
 #include <iostream>
 #include <ctime>
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
 using namespace std;
 
 void InsertionSort(int arr[], int n) {
@@ -15,25 +17,66 @@ void InsertionSort(int arr[], int n) {
     }
 }
 
-    void measureExecutionTime(int n) {
-        int arr[n];
+// One aligned heap buffer reused by every run. It only grows, so the sweep
+// allocates once per new maximum size instead of once per run, and large
+// sizes no longer live on the stack.
+class BufferPool {
+public:
+    BufferPool() : data(nullptr), capacity(0) {}
+    ~BufferPool() { free(data); }
+
+    int* acquire(size_t n) {
+        if (n > capacity) {
+            free(data);
+            size_t bytes = ((n * sizeof(int) + 63) / 64) * 64;
+            data = static_cast<int*>(aligned_alloc(64, bytes));
+            capacity = data ? n : 0;
+        }
+        return data;
+    }
+
+private:
+    int* data;
+    size_t capacity;
+};
+
+    // Inputs above cutover are sorted with an O(n log n) sort instead
+    void measureExecutionTime(BufferPool& pool, int n, int cutover) {
+        int* arr = pool.acquire(n);
+        if (!arr) {
+            cout << "Input size: " << n << ", could not allocate buffer" << endl;
+            return;
+        }
         for (int i = 0; i < n; ++i) {
             arr[i] = rand() % 100;
         }
 
+        bool quadratic = n <= cutover;
         clock_t start = clock();
-        InsertionSort(arr, n);
+        if (quadratic)
+            InsertionSort(arr, n);
+        else
+            sort(arr, arr + n);
         clock_t end = clock();
 
         double duration = double(end - start) / CLOCKS_PER_SEC;
-        cout << "Input size: " << n << ", Time taken: " << duration << " seconds" << endl;
+        cout << "Input size: " << n << ", Time taken: " << duration << " seconds"
+             << (quadratic ? " (insertion sort)" : " (std::sort)") << endl;
     }
 
-int main() {
+int main(int argc, char* argv[]) {
     srand(time(0));
-    int sizes[] = {10, 100, 1000, 10000, 100000, 1000000};
+    // --cutover N: largest size still sorted with InsertionSort. 10^6 takes
+    // several minutes with insertion sort, so the default stops at 10^5.
+    int cutover = 100000;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--cutover") == 0 && i + 1 < argc)
+            cutover = atoi(argv[++i]);
+    }
+    int sizes[] = {10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    BufferPool pool;
     for (int size : sizes) {
-        measureExecutionTime(size);
+        measureExecutionTime(pool, size, cutover);
     }
     return 0;
 }
@@ -0,0 +1,238 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+
+using namespace std;
+
+// Counts every heap allocation made through operator new
+static size_t allocationCount = 0;
+
+void *operator new(size_t size) {
+    ++allocationCount;
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+static size_t stringCopies = 0;
+
+// The copying string merge alphatime.cpp used before merge_sort.hpp, with a
+// counter for the strings it copies into L/R and back
+void merge(vector<string>& arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+    vector<string> L(n1), R(n2);
+
+    for (int i = 0; i < n1; ++i)
+        L[i] = arr[left + i];
+    for (int j = 0; j < n2; ++j)
+        R[j] = arr[mid + 1 + j];
+    stringCopies += 2 * (n1 + n2); // into L/R and back into arr
+
+    int i = 0, j = 0, k = left;
+    while (i < n1 && j < n2) {
+        if (L[i] <= R[j]) {
+            arr[k] = L[i];
+            ++i;
+        } else {
+            arr[k] = R[j];
+            ++j;
+        }
+        ++k;
+    }
+
+    while (i < n1) {
+        arr[k] = L[i];
+        ++i;
+        ++k;
+    }
+
+    while (j < n2) {
+        arr[k] = R[j];
+        ++j;
+        ++k;
+    }
+}
+
+// Merge Sort function for strings
+void mergeSort(vector<string>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSort(arr, left, mid);
+        mergeSort(arr, mid + 1, right);
+        merge(arr, left, mid, right);
+    }
+}
+
+// Move-based merge: the left half is moved into one shared buffer and the
+// strings are moved back, so no characters are copied
+void moveMerge(vector<string>& arr, int left, int mid, int right, vector<string>& buf) {
+    int n1 = mid - left + 1;
+    for (int i = 0; i < n1; ++i)
+        buf[i] = move(arr[left + i]);
+
+    int i = 0, j = mid + 1, k = left;
+    while (i < n1 && j <= right) {
+        if (buf[i] <= arr[j])
+            arr[k++] = move(buf[i++]);
+        else
+            arr[k++] = move(arr[j++]);
+    }
+    while (i < n1)
+        arr[k++] = move(buf[i++]);
+}
+
+void moveMergeSort(vector<string>& arr, int left, int right, vector<string>& buf) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        moveMergeSort(arr, left, mid, buf);
+        moveMergeSort(arr, mid + 1, right, buf);
+        moveMerge(arr, left, mid, right, buf);
+    }
+}
+
+void moveMergeSort(vector<string>& arr) {
+    vector<string> buf((arr.size() + 1) / 2);
+    moveMergeSort(arr, 0, (int)arr.size() - 1, buf);
+}
+
+// Sort key: the first 8 bytes of the string packed big-endian (zero padded)
+// so that comparing two prefixes as integers orders them like the strings
+struct PrefixKey {
+    uint64_t prefix;
+    uint32_t index;
+};
+
+uint64_t packPrefix(const string& s) {
+    uint64_t p = 0;
+    size_t len = s.size() < 8 ? s.size() : 8;
+    for (size_t i = 0; i < len; ++i)
+        p |= (uint64_t)(unsigned char)s[i] << (56 - 8 * i);
+    return p;
+}
+
+// Equal prefixes (a shared first 8 bytes, or a short string vs one with
+// trailing NULs) fall back to the full string compare
+inline bool keyLessEqual(const PrefixKey& a, const PrefixKey& b, const vector<string>& arr) {
+    if (a.prefix != b.prefix)
+        return a.prefix < b.prefix;
+    return arr[a.index] <= arr[b.index];
+}
+
+void keyMerge(const PrefixKey src[], PrefixKey dst[], int lo, int mid, int hi, const vector<string>& arr) {
+    int i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        if (keyLessEqual(src[i], src[j], arr))
+            dst[k++] = src[i++];
+        else
+            dst[k++] = src[j++];
+    }
+    while (i < mid)
+        dst[k++] = src[i++];
+    while (j < hi)
+        dst[k++] = src[j++];
+}
+
+// Ping-pong merge sort over the 16-byte keys (see scratch.cpp)
+void keySort(PrefixKey src[], PrefixKey dst[], int lo, int hi, const vector<string>& arr) {
+    if (hi - lo < 2)
+        return;
+    int mid = lo + (hi - lo) / 2;
+    keySort(dst, src, lo, mid, arr);
+    keySort(dst, src, mid, hi, arr);
+    keyMerge(src, dst, lo, mid, hi, arr);
+}
+
+// Sorts an index array by cached prefix, then moves each string once into
+// its final place
+void prefixIndexSort(vector<string>& arr) {
+    int n = arr.size();
+    vector<PrefixKey> keys(n), scratch(n);
+    for (int i = 0; i < n; ++i)
+        keys[i] = PrefixKey{packPrefix(arr[i]), (uint32_t)i};
+    scratch = keys;
+    keySort(scratch.data(), keys.data(), 0, n, arr);
+
+    vector<string> sorted(n);
+    for (int i = 0; i < n; ++i)
+        sorted[i] = move(arr[keys[i].index]);
+    arr.swap(sorted);
+}
+
+// Function to generate random strings
+vector<string> generateRandomStrings(int n) {
+    vector<string> arr(n);
+    static const char alphanum[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    for (int i = 0; i < n; ++i) {
+        string str;
+        for (int j = 0; j < 5; ++j) {
+            str += alphanum[rand() % (sizeof(alphanum) - 1)];
+        }
+        arr[i] = str;
+    }
+    return arr;
+}
+
+struct RunStats {
+    double seconds;
+    size_t allocations;
+    size_t copies;
+};
+
+template <typename SortFn>
+RunStats runSort(const vector<string>& input, vector<string>& out, SortFn sortFn) {
+    out = input;
+    size_t allocsBefore = allocationCount;
+    size_t copiesBefore = stringCopies;
+    auto start = chrono::high_resolution_clock::now();
+    sortFn(out);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> duration = end - start;
+    return RunStats{duration.count(), allocationCount - allocsBefore, stringCopies - copiesBefore};
+}
+
+void report(const string& name, const RunStats& s) {
+    cout << "  " << name << ": " << s.seconds << " seconds, "
+         << s.copies << " string copies, " << s.allocations << " allocations" << endl;
+}
+
+// Measure execution time
+void measureExecutionTime(int n) {
+    vector<string> input = generateRandomStrings(n);
+    vector<string> a, b, c;
+
+    RunStats copying = runSort(input, a, [](vector<string>& v) { mergeSort(v, 0, v.size() - 1); });
+    RunStats moving = runSort(input, b, [](vector<string>& v) { moveMergeSort(v); });
+    RunStats prefix = runSort(input, c, [](vector<string>& v) { prefixIndexSort(v); });
+
+    double tn = n * log2(n);
+    cout << "Size: " << n << ", T(n): " << tn << endl;
+    report("copying mergeSort", copying);
+    report("move mergeSort", moving);
+    report("prefix index sort", prefix);
+    if (a != b || a != c)
+        cout << "  MISMATCH between sorts" << endl;
+}
+
+int main() {
+    srand(time(0));
+    int sizes[] = {10, 100, 1000, 10000, 100000, 1000000};
+    for (int size : sizes) {
+        measureExecutionTime(size);
+    }
+    return 0;
+}
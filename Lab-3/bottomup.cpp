@@ -0,0 +1,306 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+using namespace std;
+
+// Top-down baseline for the bottom-up sorts: merge.cpp's pre-merge_sort.hpp
+// merge, copying each half into new L/R vectors
+void merge(vector<int> &arr, int l, int m, int r){
+    int n1 = m - l + 1;
+    int n2 = r - m;
+    vector<int> L(n1), R(n2);
+    for(int i = 0; i < n1; i++){
+        L[i] = arr[l + i];
+    }
+    for(int j = 0; j < n2; j++){
+        R[j] = arr[m + 1 + j];
+    }
+    int i = 0; int j = 0; int k = l;
+    while(i < n1 && j < n2){
+        if(L[i]<=R[j]){
+            arr[k] = L[i]; i++;
+        }else{
+            arr[k] = R[j]; j++;
+        }
+        k++;
+    }
+    while(i < n1){
+        arr[k] = L[i]; i++;k++;
+    }
+    while(j < n2){
+        arr[k] = R[j]; j++; k++;
+    }
+}
+
+void mergeSort(vector<int> &arr, int l, int r){
+    if(l < r){
+        int m = l + (r - l) / 2;
+        mergeSort(arr, l, m);
+        mergeSort(arr, m+1, r);
+        merge(arr, l, m, r);
+    }
+}
+
+// Hardware counter read through perf_event_open; value() is -1 when the
+// kernel or the sandbox does not allow it
+class PerfCounter {
+public:
+    PerfCounter(unsigned type, unsigned long long config) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    ~PerfCounter() {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    void start() {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    void stop() {
+        if (fd >= 0)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    long long value() const {
+        long long count;
+        if (fd < 0 || read(fd, &count, sizeof(count)) != sizeof(count))
+            return -1;
+        return count;
+    }
+
+private:
+    int fd;
+};
+
+// Cache size in bytes, with a fallback when sysconf does not know it
+size_t cacheSize(int name, size_t fallback) {
+    long size = sysconf(name);
+    return size > 0 ? size : fallback;
+}
+
+size_t floorPow2(size_t x) {
+    size_t p = 1;
+    while (p * 2 <= x)
+        p *= 2;
+    return p;
+}
+
+const size_t TILE = 32;
+
+// Merges two sorted runs into out (stable: a before b on ties)
+void merge2(const int *a, const int *ae, const int *b, const int *be, int *out) {
+    while (a < ae && b < be)
+        *out++ = *a <= *b ? *a++ : *b++;
+    while (a < ae)
+        *out++ = *a++;
+    while (b < be)
+        *out++ = *b++;
+}
+
+void merge3(const int *a, const int *ae, const int *b, const int *be, const int *c, const int *ce, int *out) {
+    while (a < ae && b < be && c < ce) {
+        if (*a <= *b)
+            *out++ = *a <= *c ? *a++ : *c++;
+        else
+            *out++ = *b <= *c ? *b++ : *c++;
+    }
+    if (a == ae)
+        merge2(b, be, c, ce, out);
+    else if (b == be)
+        merge2(a, ae, c, ce, out);
+    else
+        merge2(a, ae, b, be, out);
+}
+
+// Four-run merge as a two-level tournament: a/b and c/d play first, the
+// winners play each other. When one run empties, the rest is a 3-way merge.
+void merge4(const int *a, const int *ae, const int *b, const int *be,
+            const int *c, const int *ce, const int *d, const int *de, int *out) {
+    while (a < ae && b < be && c < ce && d < de) {
+        bool ab = *a <= *b, cd = *c <= *d;
+        int x = ab ? *a : *b, y = cd ? *c : *d;
+        bool xy = x <= y;
+        *out++ = xy ? x : y;
+        // Advance without branches on the data
+        a += xy & ab;
+        b += xy & !ab;
+        c += !xy & cd;
+        d += !xy & !cd;
+    }
+    if (a == ae)
+        merge3(b, be, c, ce, d, de, out);
+    else if (b == be)
+        merge3(a, ae, c, ce, d, de, out);
+    else if (c == ce)
+        merge3(a, ae, b, be, d, de, out);
+    else
+        merge3(a, ae, b, be, c, ce, out);
+}
+
+// Bottom-up 2-way passes over [lo, hi): runs of `width` are merged from src
+// into dst, the buffers swap, until runs reach `limit`. Returns the buffer
+// holding the result.
+int *passes2(int *src, int *dst, size_t lo, size_t hi, size_t width, size_t limit) {
+    for (; width < limit && width < hi - lo; width *= 2) {
+        for (size_t s = lo; s < hi; s += 2 * width) {
+            size_t m = min(s + width, hi), e = min(s + 2 * width, hi);
+            merge2(src + s, src + m, src + m, src + e, dst + s);
+        }
+        swap(src, dst);
+    }
+    return src;
+}
+
+int *passes4(int *src, int *dst, size_t lo, size_t hi, size_t width, size_t limit) {
+    for (; width < limit && width < hi - lo; width *= 4) {
+        for (size_t s = lo; s < hi; s += 4 * width) {
+            size_t m1 = min(s + width, hi), m2 = min(s + 2 * width, hi);
+            size_t m3 = min(s + 3 * width, hi), e = min(s + 4 * width, hi);
+            merge4(src + s, src + m1, src + m1, src + m2, src + m2, src + m3, src + m3, src + e, dst + s);
+        }
+        swap(src, dst);
+    }
+    return src;
+}
+
+// Iterative merge sort in three levels. 32-element tiles are insertion
+// sorted, then merged up to half the L1 size while the block stays in L1,
+// then up to half the L2 size the same way. Only the remaining passes
+// stream through memory, 2 or 4 runs at a time. Each block's result is
+// left in whichever buffer the first memory pass reads from, so the last
+// pass ends in arr without a copy.
+void bottomUpMergeSort(int arr[], size_t n, int ways) {
+    if (n < 2)
+        return;
+    size_t l1 = max(TILE, floorPow2(cacheSize(_SC_LEVEL1_DCACHE_SIZE, 32 << 10) / (2 * sizeof(int))));
+    size_t l2 = max(l1, floorPow2(cacheSize(_SC_LEVEL2_CACHE_SIZE, 1 << 20) / (2 * sizeof(int))));
+    int *scratch = new int[n];
+
+    for (size_t s = 0; s < n; s += TILE) {
+        size_t e = min(s + TILE, n);
+        for (size_t i = s + 1; i < e; ++i) {
+            int key = arr[i];
+            size_t j = i;
+            while (j > s && arr[j - 1] > key) {
+                arr[j] = arr[j - 1];
+                --j;
+            }
+            arr[j] = key;
+        }
+    }
+
+    // Memory passes still needed after the cache-sized blocks; if odd, the
+    // blocks are left in scratch
+    int memoryPasses = 0;
+    for (size_t w = l2; w < n; w *= ways)
+        ++memoryPasses;
+    int *target = memoryPasses % 2 ? scratch : arr;
+
+    for (size_t s = 0; s < n; s += l2) {
+        size_t e = min(s + l2, n);
+        for (size_t b = s; b < e; b += l1) {
+            size_t be = min(b + l1, e);
+            if (passes2(arr, scratch, b, be, TILE, l1) != arr)
+                copy(scratch + b, scratch + be, arr + b);
+        }
+        int *res = passes2(arr, scratch, s, e, l1, l2);
+        if (res != target)
+            copy(res + s, res + e, target + s);
+    }
+
+    int *other = target == arr ? scratch : arr;
+    if (ways == 4)
+        passes4(target, other, 0, n, l2, n);
+    else
+        passes2(target, other, 0, n, l2, n);
+    delete[] scratch;
+}
+
+struct Measurement {
+    double seconds;
+    long long l1Misses;
+    long long llcMisses;
+};
+
+template <typename SortFn>
+Measurement measure(SortFn sortFn) {
+    PerfCounter l1(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    PerfCounter llc(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    l1.start();
+    llc.start();
+    clock_t start = clock();
+    sortFn();
+    clock_t end = clock();
+    l1.stop();
+    llc.stop();
+    return Measurement{double(end - start) / CLOCKS_PER_SEC, l1.value(), llc.value()};
+}
+
+string counterText(long long count) {
+    return count < 0 ? "n/a" : to_string(count);
+}
+
+void report(const string &name, const Measurement &m, bool ok) {
+    cout << "  " << name << ": " << m.seconds << " seconds, L1D misses: " << counterText(m.l1Misses)
+         << ", cache misses: " << counterText(m.llcMisses) << (ok ? "" : " MISMATCH") << endl;
+}
+
+// Measure execution time
+void measureExecutionTime(int n, int baselineLimit) {
+    vector<int> input(n);
+    for (int i = 0; i < n; ++i) {
+        input[i] = rand();
+    }
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end());
+
+    cout << "Size: " << n << endl;
+    vector<int> arr;
+    if (n <= baselineLimit) {
+        arr = input;
+        Measurement m = measure([&] { mergeSort(arr, 0, n - 1); });
+        report("top-down mergeSort", m, arr == expected);
+    }
+    arr = input;
+    Measurement m2 = measure([&] { bottomUpMergeSort(arr.data(), n, 2); });
+    report("bottom-up 2-way", m2, arr == expected);
+    arr = input;
+    Measurement m4 = measure([&] { bottomUpMergeSort(arr.data(), n, 4); });
+    report("bottom-up 4-way", m4, arr == expected);
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    cout << "L1D: " << cacheSize(_SC_LEVEL1_DCACHE_SIZE, 32 << 10) / 1024 << " KB, L2: "
+         << cacheSize(_SC_LEVEL2_CACHE_SIZE, 1 << 20) / 1024 << " KB" << endl;
+    // The top-down version is skipped above this size if given
+    int baselineLimit = argc > 1 ? atoi(argv[1]) : 100000000;
+    int sizes[] = {1000, 10000, 100000, 1000000, 10000000, 100000000};
+    for (int size : sizes) {
+        measureExecutionTime(size, baselineLimit);
+    }
+    return 0;
+}
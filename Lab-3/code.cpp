@@ -2,59 +2,14 @@
 #include <vector>
 #include <chrono>
 #include <cmath>
+#include "merge_sort.hpp"
 
 using namespace std;
 
-// Merge function
-void merge(vector<double>& arr, int left, int mid, int right) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-    vector<double> L(n1), R(n2);
-
-    for (int i = 0; i < n1; ++i)
-        L[i] = arr[left + i];
-    for (int j = 0; j < n2; ++j)
-        R[j] = arr[mid + 1 + j];
-
-    int i = 0, j = 0, k = left;
-    while (i < n1 && j < n2) {
-        if (L[i] <= R[j]) {
-            arr[k] = L[i];
-            ++i;
-        } else {
-            arr[k] = R[j];
-            ++j;
-        }
-        ++k;
-    }
-
-    while (i < n1) {
-        arr[k] = L[i];
-        ++i;
-        ++k;
-    }
-
-    while (j < n2) {
-        arr[k] = R[j];
-        ++j;
-        ++k;
-    }
-}
-
-// Merge Sort function
-void mergeSort(vector<double>& arr, int left, int right) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid);
-        mergeSort(arr, mid + 1, right);
-        merge(arr, left, mid, right);
-    }
-}
-
 // Function to calculate time and sort
 double sortAndMeasureTime(vector<double>& arr) {
     auto start = chrono::high_resolution_clock::now();
-    mergeSort(arr, 0, arr.size() - 1);
+    merge_sort(arr.begin(), arr.end());
     auto end = chrono::high_resolution_clock::now();
     chrono::duration<double> duration = end - start;
     return duration.count();
@@ -0,0 +1,489 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+
+using namespace std;
+
+// Merge of arr[left..mid] and arr[mid+1..right] with the left half moved
+// into a shared buffer: merge.cpp's original two-vector merge reworked to
+// allocate once per run, with moves so it also works for strings
+template <typename T>
+void merge(vector<T>& arr, size_t left, size_t mid, size_t right, vector<T>& buf) {
+    size_t n1 = mid - left + 1;
+    for (size_t i = 0; i < n1; ++i)
+        buf[i] = move(arr[left + i]);
+
+    size_t i = 0, j = mid + 1, k = left;
+    while (i < n1 && j <= right) {
+        if (buf[i] <= arr[j])
+            arr[k++] = move(buf[i++]);
+        else
+            arr[k++] = move(arr[j++]);
+    }
+    while (i < n1)
+        arr[k++] = move(buf[i++]);
+}
+
+template <typename T>
+void mergeSort(vector<T>& arr, size_t left, size_t right, vector<T>& buf) {
+    if (left < right) {
+        size_t mid = left + (right - left) / 2;
+        mergeSort(arr, left, mid, buf);
+        mergeSort(arr, mid + 1, right, buf);
+        merge(arr, left, mid, right, buf);
+    }
+}
+
+template <typename T>
+void mergeSort(vector<T>& arr) {
+    if (arr.size() < 2)
+        return;
+    vector<T> buf((arr.size() + 1) / 2);
+    mergeSort(arr, 0, arr.size() - 1, buf);
+}
+
+// Sequential reader with double buffering: while the caller consumes one
+// block, the next one is already being read on another thread
+class AsyncBlockReader {
+public:
+    AsyncBlockReader(FILE* f, size_t blockSize) : f(f), cur(blockSize), next(blockSize), pos(0), len(0), eof(false) {
+        startRead();
+    }
+
+    ~AsyncBlockReader() {
+        if (pending.valid())
+            pending.wait();
+    }
+
+    // Makes the next block current; false at end of file, and on every
+    // call after that
+    bool refill() {
+        if (eof)
+            return false;
+        len = pending.get();
+        swap(cur, next);
+        pos = 0;
+        if (len == 0) {
+            eof = true;
+            return false;
+        }
+        startRead();
+        return true;
+    }
+
+    // Blocks are a multiple of size, so a record cut short can only be the
+    // end of a file whose length is not a multiple of size
+    bool readValue(char* out, size_t size) {
+        if (pos + size > len) {
+            if (pos < len) {
+                cerr << "Truncated record: " << len - pos << " trailing bytes, expected " << size << endl;
+                exit(1);
+            }
+            if (!refill())
+                return false;
+            if (size > len) {
+                cerr << "Truncated record: " << len << " trailing bytes, expected " << size << endl;
+                exit(1);
+            }
+        }
+        memcpy(out, cur.data() + pos, size);
+        pos += size;
+        return true;
+    }
+
+    bool readLine(string& line) {
+        line.clear();
+        for (;;) {
+            if (pos == len && !refill())
+                return !line.empty();
+            const char* start = cur.data() + pos;
+            const char* nl = (const char*)memchr(start, '\n', len - pos);
+            if (nl) {
+                line.append(start, nl - start);
+                pos += nl - start + 1;
+                return true;
+            }
+            line.append(start, len - pos);
+            pos = len;
+        }
+    }
+
+private:
+    FILE* f;
+    vector<char> cur, next;
+    size_t pos, len;
+    bool eof;
+    future<size_t> pending;
+
+    void startRead() {
+        char* dst = next.data();
+        size_t size = next.size();
+        FILE* file = f;
+        pending = async(launch::async, [file, dst, size] { return fread(dst, 1, size, file); });
+    }
+};
+
+// How each record type is read, written and charged against the budget.
+// Numbers are stored as raw native binary, strings as newline-terminated text.
+template <typename T>
+struct Format {
+    static bool read(AsyncBlockReader& in, T& value) { return in.readValue((char*)&value, sizeof(T)); }
+    static void write(FILE* out, const T& value) { fwrite_unlocked(&value, sizeof(T), 1, out); }
+    static void writeAll(FILE* out, const vector<T>& values) { fwrite(values.data(), sizeof(T), values.size(), out); }
+    static size_t bytes(const T&) { return sizeof(T); }
+    static size_t memory(const T&) { return sizeof(T) * 3 / 2; } // + half for the merge buffer
+    static size_t blockAlign() { return sizeof(T); }
+};
+
+template <>
+struct Format<string> {
+    static bool read(AsyncBlockReader& in, string& value) { return in.readLine(value); }
+    static void write(FILE* out, const string& value) {
+        fwrite_unlocked(value.data(), 1, value.size(), out);
+        fputc_unlocked('\n', out);
+    }
+    static void writeAll(FILE* out, const vector<string>& values) {
+        for (const string& v : values)
+            write(out, v);
+    }
+    static size_t bytes(const string& s) { return s.size() + 1; }
+    static size_t memory(const string& s) { return s.capacity() + sizeof(string) * 3 / 2; }
+    static size_t blockAlign() { return 1; }
+};
+
+// Loser tree over k sorted streams: tree[0] holds the winner (the stream
+// with the smallest head), every inner node the loser of its match. After
+// the winner advances only the matches on its leaf-to-root path are
+// replayed: log2(k) compares per record. Ties go to the lower run index,
+// which keeps the merge stable.
+template <typename T>
+class LoserTree {
+public:
+    LoserTree(const vector<T>& heads, const vector<char>& done) : heads(heads), done(done), k(heads.size()), tree(k, -1) {
+        for (int leaf = 0; leaf < k; ++leaf) {
+            int w = leaf;
+            for (int node = (leaf + k) / 2; node > 0; node /= 2) {
+                if (tree[node] < 0) {
+                    tree[node] = w;
+                    w = -1;
+                    break;
+                }
+                if (beats(tree[node], w))
+                    swap(tree[node], w);
+            }
+            if (w >= 0)
+                tree[0] = w;
+        }
+    }
+
+    int winner() const { return tree[0]; }
+
+    // Call after the winner's head changed
+    void replay() {
+        int w = tree[0];
+        for (int node = (w + k) / 2; node > 0; node /= 2)
+            if (beats(tree[node], w))
+                swap(tree[node], w);
+        tree[0] = w;
+    }
+
+private:
+    const vector<T>& heads;
+    const vector<char>& done;
+    int k;
+    vector<int> tree;
+
+    bool beats(int a, int b) const {
+        if (done[a] || done[b])
+            return !done[a];
+        if (heads[a] < heads[b])
+            return true;
+        if (heads[b] < heads[a])
+            return false;
+        return a < b;
+    }
+};
+
+string makeTempFile(const string& dir) {
+    string path = dir + "/extsort-XXXXXX";
+    vector<char> name(path.begin(), path.end());
+    name.push_back('\0');
+    int fd = mkstemp(name.data());
+    if (fd < 0) {
+        perror("mkstemp");
+        exit(1);
+    }
+    close(fd);
+    return string(name.data());
+}
+
+FILE* openFile(const string& path, const char* mode, size_t bufferSize) {
+    FILE* f = fopen(path.c_str(), mode);
+    if (!f) {
+        perror(path.c_str());
+        exit(1);
+    }
+    if (bufferSize > 0)
+        setvbuf(f, nullptr, _IOFBF, bufferSize); // large sequential writes
+    return f;
+}
+
+size_t blockSizeFor(size_t bytes, size_t align) {
+    bytes = max<size_t>(bytes, 64 << 10);
+    return bytes / align * align;
+}
+
+struct SortStats {
+    size_t records = 0;
+    size_t runs = 0;
+    size_t mergePasses = 0;
+    double runSeconds = 0;
+    double mergeSeconds = 0;
+};
+
+// Phase 1: fill the memory budget, sort in memory, spill a run
+template <typename T>
+vector<string> generateRuns(const string& input, size_t budget, const string& tmpDir, size_t& records) {
+    vector<string> runs;
+    FILE* in = openFile(input, "rb", 0);
+    AsyncBlockReader reader(in, blockSizeFor(budget / 16, Format<T>::blockAlign()));
+    vector<T> chunk;
+    T value;
+    bool more = true;
+    while (more) {
+        size_t used = 0;
+        chunk.clear();
+        while (used < budget && (more = Format<T>::read(reader, value))) {
+            used += Format<T>::memory(value);
+            chunk.push_back(move(value));
+        }
+        if (chunk.empty())
+            break;
+        records += chunk.size();
+        mergeSort(chunk);
+        string path = makeTempFile(tmpDir);
+        FILE* out = openFile(path, "wb", 8 << 20);
+        Format<T>::writeAll(out, chunk);
+        fclose(out);
+        runs.push_back(path);
+    }
+    fclose(in);
+    return runs;
+}
+
+// Phase 2: k-way merge of the given runs into output
+template <typename T>
+void mergeRuns(const vector<string>& runs, const string& output, size_t budget) {
+    int k = runs.size();
+    // Two read buffers per run plus one write buffer share the budget
+    size_t block = blockSizeFor(budget / (2 * k + 2), Format<T>::blockAlign());
+    vector<FILE*> files(k);
+    vector<unique_ptr<AsyncBlockReader>> readers(k);
+    vector<T> heads(k);
+    vector<char> done(k, 0);
+    for (int i = 0; i < k; ++i) {
+        files[i] = openFile(runs[i], "rb", 0);
+        readers[i].reset(new AsyncBlockReader(files[i], block));
+        done[i] = !Format<T>::read(*readers[i], heads[i]);
+    }
+
+    FILE* out = openFile(output, "wb", max<size_t>(block * 2, 1 << 20));
+    LoserTree<T> tree(heads, done);
+    while (k > 0 && !done[tree.winner()]) {
+        int w = tree.winner();
+        Format<T>::write(out, heads[w]);
+        done[w] = !Format<T>::read(*readers[w], heads[w]);
+        tree.replay();
+    }
+    fclose(out);
+
+    for (int i = 0; i < k; ++i) {
+        readers[i].reset();
+        fclose(files[i]);
+    }
+}
+
+// External merge sort: runs under the memory budget, then merges with a
+// bounded fan-in, adding intermediate passes when there are too many runs
+template <typename T>
+SortStats externalSort(const string& input, const string& output, size_t budget, const string& tmpDir) {
+    SortStats stats;
+    auto start = chrono::high_resolution_clock::now();
+    vector<string> runs = generateRuns<T>(input, budget, tmpDir, stats.records);
+    auto mid = chrono::high_resolution_clock::now();
+    stats.runs = runs.size();
+    stats.runSeconds = chrono::duration<double>(mid - start).count();
+
+    // Each input needs two blocks of at least 64 KB
+    size_t fanIn = max<size_t>(2, min<size_t>(512, budget / (2 * (64 << 10))));
+    while (runs.size() > fanIn) {
+        vector<string> next;
+        for (size_t i = 0; i < runs.size(); i += fanIn) {
+            vector<string> group(runs.begin() + i, runs.begin() + min(runs.size(), i + fanIn));
+            string path = makeTempFile(tmpDir);
+            mergeRuns<T>(group, path, budget);
+            for (const string& r : group)
+                remove(r.c_str());
+            next.push_back(path);
+        }
+        runs.swap(next);
+        ++stats.mergePasses;
+    }
+    if (runs.empty()) {
+        fclose(openFile(output, "wb", 0));
+    } else {
+        mergeRuns<T>(runs, output, budget);
+        ++stats.mergePasses;
+    }
+    for (const string& r : runs)
+        remove(r.c_str());
+
+    stats.mergeSeconds = chrono::duration<double>(chrono::high_resolution_clock::now() - mid).count();
+    return stats;
+}
+
+template <typename T>
+T randomValue();
+
+template <>
+int randomValue<int>() { return rand() - RAND_MAX / 2; }
+
+template <>
+double randomValue<double>() { return (rand() - RAND_MAX / 2) / (double)RAND_MAX * 1e6; }
+
+template <>
+string randomValue<string>() {
+    static const char alphanum[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    string str;
+    int len = 5 + rand() % 20;
+    for (int j = 0; j < len; ++j)
+        str += alphanum[rand() % (sizeof(alphanum) - 1)];
+    return str;
+}
+
+template <typename T>
+void generateFile(const string& path, size_t bytes) {
+    FILE* out = openFile(path, "wb", 8 << 20);
+    size_t written = 0;
+    while (written < bytes) {
+        T v = randomValue<T>();
+        Format<T>::write(out, v);
+        written += Format<T>::bytes(v);
+    }
+    fclose(out);
+}
+
+// Streams the output once and checks it is non-decreasing and holds as
+// many records as the input
+template <typename T>
+bool verifySorted(const string& path, size_t expected, size_t& count) {
+    FILE* in = openFile(path, "rb", 0);
+    bool ok = true;
+    {
+        AsyncBlockReader reader(in, 1 << 20);
+        T prev, cur;
+        count = 0;
+        while (Format<T>::read(reader, cur)) {
+            if (count > 0 && cur < prev)
+                ok = false;
+            prev = move(cur);
+            ++count;
+        }
+    }
+    fclose(in);
+    return ok && count == expected;
+}
+
+long long fileSize(const string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f)
+        return 0;
+    fseek(f, 0, SEEK_END);
+    long long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+template <typename T>
+void benchmark(const string& type, size_t sizeMB, size_t memoryMB, const string& tmpDir) {
+    string input = makeTempFile(tmpDir), output = makeTempFile(tmpDir);
+    generateFile<T>(input, sizeMB << 20);
+    double mb = fileSize(input) / double(1 << 20);
+
+    SortStats s = externalSort<T>(input, output, memoryMB << 20, tmpDir);
+    size_t count;
+    bool ok = verifySorted<T>(output, s.records, count);
+    double total = s.runSeconds + s.mergeSeconds;
+
+    cout << "Type: " << type << ", Size: " << mb << " MB, Memory: " << memoryMB << " MB, Records: " << count
+         << ", Runs: " << s.runs << ", Merge passes: " << s.mergePasses << endl;
+    cout << "  run generation: " << s.runSeconds << " s (" << mb / s.runSeconds << " MB/s)"
+         << ", merge: " << s.mergeSeconds << " s (" << mb * s.mergePasses / s.mergeSeconds << " MB/s)"
+         << ", total: " << total << " s (" << mb / total << " MB/s)" << (ok ? "" : " NOT SORTED OR RECORDS LOST") << endl;
+
+    remove(input.c_str());
+    remove(output.c_str());
+}
+
+template <typename T>
+int dispatch(const string& command, char* argv[], int argc, const string& tmpDir) {
+    if (command == "sort" && argc >= 5) {
+        size_t memoryMB = argc > 5 ? atoi(argv[5]) : 256;
+        SortStats s = externalSort<T>(argv[3], argv[4], memoryMB << 20, tmpDir);
+        double mb = fileSize(argv[3]) / double(1 << 20);
+        double total = s.runSeconds + s.mergeSeconds;
+        cout << "Runs: " << s.runs << ", Merge passes: " << s.mergePasses
+             << ", Time taken: " << total << " seconds (" << mb / total << " MB/s)" << endl;
+        return 0;
+    }
+    if (command == "generate" && argc >= 5) {
+        generateFile<T>(argv[4], (size_t)atoi(argv[3]) << 20);
+        return 0;
+    }
+    return -1;
+}
+
+int main(int argc, char* argv[]) {
+    srand(time(0));
+    const char* env = getenv("TMPDIR");
+    string tmpDir = env ? env : "/tmp";
+    string command = argc > 1 ? argv[1] : "bench";
+    string type = argc > 2 ? argv[2] : "all";
+
+    if (command == "bench") {
+        size_t sizeMB = argc > 3 ? atoi(argv[3]) : 256;
+        size_t memoryMB = argc > 4 ? atoi(argv[4]) : 32;
+        if (type == "int" || type == "all")
+            benchmark<int>("int", sizeMB, memoryMB, tmpDir);
+        if (type == "double" || type == "all")
+            benchmark<double>("double", sizeMB, memoryMB, tmpDir);
+        if (type == "string" || type == "all")
+            benchmark<string>("string", sizeMB, memoryMB, tmpDir);
+        return 0;
+    }
+
+    int status = -1;
+    if (type == "int")
+        status = dispatch<int>(command, argv, argc, tmpDir);
+    else if (type == "double")
+        status = dispatch<double>(command, argv, argc, tmpDir);
+    else if (type == "string")
+        status = dispatch<string>(command, argv, argc, tmpDir);
+    if (status < 0) {
+        cerr << "Usage: " << argv[0] << " sort <int|double|string> <input> <output> [memoryMB]\n"
+             << "       " << argv[0] << " generate <int|double|string> <sizeMB> <output>\n"
+             << "       " << argv[0] << " bench [int|double|string|all] [sizeMB] [memoryMB]\n";
+        return 1;
+    }
+    return status;
+}
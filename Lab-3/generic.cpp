@@ -0,0 +1,169 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <algorithm>
+#include "merge_sort.hpp"
+
+using namespace std;
+
+// The hand-specialized merge sort the drivers used before merge_sort.hpp,
+// one copy per element type as in merge.cpp, code.cpp and alphatime.cpp
+template <typename T>
+void merge(vector<T>& arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+    vector<T> L(n1), R(n2);
+
+    for (int i = 0; i < n1; ++i)
+        L[i] = arr[left + i];
+    for (int j = 0; j < n2; ++j)
+        R[j] = arr[mid + 1 + j];
+
+    int i = 0, j = 0, k = left;
+    while (i < n1 && j < n2) {
+        if (L[i] <= R[j]) {
+            arr[k] = L[i];
+            ++i;
+        } else {
+            arr[k] = R[j];
+            ++j;
+        }
+        ++k;
+    }
+
+    while (i < n1) {
+        arr[k] = L[i];
+        ++i;
+        ++k;
+    }
+
+    while (j < n2) {
+        arr[k] = R[j];
+        ++j;
+        ++k;
+    }
+}
+
+template <typename T>
+void mergeSort(vector<T>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSort(arr, left, mid);
+        mergeSort(arr, mid + 1, right);
+        merge(arr, left, mid, right);
+    }
+}
+
+struct Record {
+    string name;
+    int score;
+};
+
+template <typename T>
+T randomValue();
+
+template <>
+int randomValue<int>() { return rand(); }
+
+template <>
+double randomValue<double>() { return (rand() - RAND_MAX / 2) / (double)RAND_MAX * 1000.0; }
+
+template <>
+string randomValue<string>() {
+    static const char alphanum[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    string str;
+    for (int j = 0; j < 5; ++j)
+        str += alphanum[rand() % (sizeof(alphanum) - 1)];
+    return str;
+}
+
+template <>
+Record randomValue<Record>() { return Record{randomValue<string>() + randomValue<string>(), rand() % 1000}; }
+
+template <typename SortFn, typename T>
+double timeSort(const vector<T>& input, vector<T>& out, SortFn sortFn) {
+    out = input;
+    auto start = chrono::high_resolution_clock::now();
+    sortFn(out);
+    auto end = chrono::high_resolution_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// Hand-specialized copy vs merge_sort on the same input
+template <typename T>
+void compare(const string& type, int n) {
+    vector<T> input(n), a, b;
+    for (int i = 0; i < n; ++i)
+        input[i] = randomValue<T>();
+    double hand = timeSort(input, a, [](vector<T>& v) { mergeSort(v, 0, v.size() - 1); });
+    double generic = timeSort(input, b, [](vector<T>& v) { merge_sort(v.begin(), v.end()); });
+    cout << type << "\t" << n << "\t" << hand << "\t" << generic << "\t" << hand / generic
+         << (a == b ? "" : "\tMISMATCH") << endl;
+}
+
+// Records by score: the order written as a comparator lambda, as a
+// projection through a member pointer, and as a projection lambda
+void compareRecords(int n) {
+    vector<Record> input(n), a, b, c;
+    for (int i = 0; i < n; ++i)
+        input[i] = randomValue<Record>();
+    double lambda = timeSort(input, a, [](vector<Record>& v) {
+        merge_sort(v.begin(), v.end(), [](const Record& x, const Record& y) { return x.score < y.score; });
+    });
+    double projected = timeSort(input, b, [](vector<Record>& v) {
+        merge_sort(v.begin(), v.end(), less<>(), &Record::score);
+    });
+    double projectedLambda = timeSort(input, c, [](vector<Record>& v) {
+        merge_sort(v.begin(), v.end(), less<>(), [](const Record& r) { return r.score; });
+    });
+    vector<Record> expected = input;
+    stable_sort(expected.begin(), expected.end(), [](const Record& x, const Record& y) { return x.score < y.score; });
+    auto sameRecords = [](const vector<Record>& x, const vector<Record>& y) {
+        return equal(x.begin(), x.end(), y.begin(), [](const Record& p, const Record& q) {
+            return p.name == q.name && p.score == q.score;
+        });
+    };
+    bool same = sameRecords(a, expected) && sameRecords(b, expected) && sameRecords(c, expected);
+    cout << "record\t" << n << "\t" << lambda << "\t" << projected << "\t" << projectedLambda
+         << (same ? "" : "\tMISMATCH") << endl;
+}
+
+void projectionDemo() {
+    vector<Record> people = {{"Asha", 82}, {"Ben", 91}, {"Chen", 82}, {"Dana", 67}, {"Eli", 91}};
+    merge_sort(people.begin(), people.end(), greater<>(), &Record::score);
+    cout << "By score, highest first (ties keep input order):";
+    for (const Record& r : people)
+        cout << " " << r.name << "(" << r.score << ")";
+    cout << endl;
+
+    // Move-only elements, ordered by the value they point to
+    vector<unique_ptr<int>> boxes;
+    for (int v : {5, 3, 9, 1, 7})
+        boxes.push_back(make_unique<int>(v));
+    merge_sort(boxes.begin(), boxes.end(), less<>(), [](const unique_ptr<int>& p) { return *p; });
+    cout << "unique_ptr<int> by pointee:";
+    for (const auto& p : boxes)
+        cout << " " << *p;
+    cout << endl;
+}
+
+int main() {
+    srand(time(0));
+    projectionDemo();
+
+    int sizes[] = {1000, 10000, 100000, 1000000};
+    cout << "Type\tSize\thand-written (s)\tmerge_sort (s)\tSpeedup" << endl;
+    for (int n : sizes) {
+        compare<int>("int", n);
+        compare<double>("double", n);
+        compare<string>("string", n);
+    }
+    cout << "Type\tSize\tcomparator (s)\t&Record::score (s)\tprojection lambda (s)" << endl;
+    for (int n : sizes)
+        compareRecords(n);
+    return 0;
+}
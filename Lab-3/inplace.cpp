@@ -0,0 +1,243 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <cstdlib>
+#include <algorithm>
+#include <new>
+#include <malloc.h>
+
+using namespace std;
+
+// Tracks live heap bytes and their peak through operator new, using the
+// block sizes malloc reports
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+void *operator new(size_t size) {
+    void *p = malloc(size ? size : 1);
+    if (!p)
+        throw bad_alloc();
+    liveBytes += malloc_usable_size(p);
+    peakBytes = max(peakBytes, liveBytes);
+    return p;
+}
+
+// Out of line so GCC does not see malloc/free pairs in the callers and
+// warn about mismatched new/delete
+__attribute__((noinline)) void operator delete(void *p) noexcept {
+    liveBytes -= malloc_usable_size(p); // 0 for nullptr
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    operator delete(p);
+}
+
+// Heap-usage baseline: merge.cpp's merge as it was before merge_sort.hpp.
+// Its per-call L/R vectors are what the peak-byte counter picks up.
+void merge(vector<int> &arr, int l, int m, int r){
+    int n1 = m - l + 1;
+    int n2 = r - m;
+    vector<int> L(n1), R(n2);
+    for(int i = 0; i < n1; i++){
+        L[i] = arr[l + i];
+    }
+    for(int j = 0; j < n2; j++){
+        R[j] = arr[m + 1 + j];
+    }
+    int i = 0; int j = 0; int k = l;
+    while(i < n1 && j < n2){
+        if(L[i]<=R[j]){
+            arr[k] = L[i]; i++;
+        }else{
+            arr[k] = R[j]; j++;
+        }
+        k++;
+    }
+    while(i < n1){
+        arr[k] = L[i]; i++;k++;
+    }
+    while(j < n2){
+        arr[k] = R[j]; j++; k++;
+    }
+}
+
+void mergeSort(vector<int> &arr, int l, int r){
+    if(l < r){
+        int m = l + (r - l) / 2;
+        mergeSort(arr, l, m);
+        mergeSort(arr, m+1, r);
+        merge(arr, l, m, r);
+    }
+}
+
+// Stable insertion sort of arr[lo..hi), used for the leaves
+void insertionSort(int arr[], int lo, int hi) {
+    for (int i = lo + 1; i < hi; ++i) {
+        int key = arr[i];
+        int j = i;
+        while (j > lo && arr[j - 1] > key) {
+            arr[j] = arr[j - 1];
+            --j;
+        }
+        arr[j] = key;
+    }
+}
+
+// Swaps the blocks arr[lo..mid) and arr[mid..hi) with three reversals
+void rotate(int arr[], int lo, int mid, int hi) {
+    reverse(arr + lo, arr + mid);
+    reverse(arr + mid, arr + hi);
+    reverse(arr + lo, arr + hi);
+}
+
+// Merges arr[lo..mid) into place with arr[mid..hi) without a buffer
+// (SymMerge, Kim & Kutzner 2004). The split point is found by a binary
+// search that is symmetric around the midpoint of the whole range; one
+// rotation brings the two middle blocks into order and both sides are
+// merged recursively. O(m log(n/m + 1)) comparisons and O(n log n) moves.
+void symMerge(int arr[], int lo, int mid, int hi) {
+    // A single element is inserted by binary search
+    if (mid - lo == 1) {
+        int i = mid, j = hi;
+        while (i < j) {
+            int h = i + (j - i) / 2;
+            if (arr[h] < arr[lo])
+                i = h + 1;
+            else
+                j = h;
+        }
+        rotate(arr, lo, mid, i);
+        return;
+    }
+    if (hi - mid == 1) {
+        int i = lo, j = mid;
+        while (i < j) {
+            int h = i + (j - i) / 2;
+            if (!(arr[mid] < arr[h]))
+                i = h + 1;
+            else
+                j = h;
+        }
+        rotate(arr, i, mid, hi);
+        return;
+    }
+
+    int m = lo + (hi - lo) / 2;
+    int n = m + mid;
+    int start, r;
+    if (mid > m) {
+        start = n - hi;
+        r = m;
+    } else {
+        start = lo;
+        r = mid;
+    }
+    int p = n - 1;
+    while (start < r) {
+        int c = start + (r - start) / 2;
+        if (!(arr[p - c] < arr[c]))
+            start = c + 1;
+        else
+            r = c;
+    }
+
+    int end = n - start;
+    if (start < mid && mid < end)
+        rotate(arr, start, mid, end);
+    if (lo < start && start < m)
+        symMerge(arr, lo, start, m);
+    if (m < end && end < hi)
+        symMerge(arr, m, end, hi);
+}
+
+// In-place stable merge sort: insertion sorted blocks of 20, then
+// bottom-up SymMerge passes. Extra memory is the O(log n) recursion of
+// symMerge; no heap allocation at all.
+void inPlaceMergeSort(int arr[], int n) {
+    const int BLOCK = 20;
+    for (int lo = 0; lo < n; lo += BLOCK)
+        insertionSort(arr, lo, min(lo + BLOCK, n));
+    for (int width = BLOCK; width < n; width *= 2) {
+        for (int lo = 0; lo + width < n; lo += 2 * width)
+            symMerge(arr, lo, lo + width, min(lo + 2 * width, n));
+    }
+}
+
+// Buffered counterpart with the same block structure: one buffer, sized
+// for the widest left run (between n/2 and n), for the left half of each merge
+void bufferedMergeSort(int arr[], int n) {
+    const int BLOCK = 20;
+    for (int lo = 0; lo < n; lo += BLOCK)
+        insertionSort(arr, lo, min(lo + BLOCK, n));
+    int widest = BLOCK;
+    while (widest * 2 < n)
+        widest *= 2;
+    vector<int> buf(widest);
+    for (int width = BLOCK; width < n; width *= 2) {
+        for (int lo = 0; lo + width < n; lo += 2 * width) {
+            int mid = lo + width, hi = min(lo + 2 * width, n);
+            copy(arr + lo, arr + mid, buf.begin());
+            int i = 0, j = mid, k = lo, n1 = width;
+            while (i < n1 && j < hi)
+                arr[k++] = buf[i] <= arr[j] ? buf[i++] : arr[j++];
+            while (i < n1)
+                arr[k++] = buf[i++];
+        }
+    }
+}
+
+struct Result {
+    double seconds;
+    size_t peakExtraBytes;
+};
+
+template <typename SortFn>
+Result measure(SortFn sortFn) {
+    size_t before = liveBytes;
+    peakBytes = liveBytes;
+    clock_t start = clock();
+    sortFn();
+    clock_t end = clock();
+    return Result{double(end - start) / CLOCKS_PER_SEC, peakBytes - before};
+}
+
+// Measure execution time and the peak auxiliary heap memory
+void measureExecutionTime(int n, int baselineLimit) {
+    vector<int> input(n);
+    for (int i = 0; i < n; ++i) {
+        input[i] = rand() % 1000;
+    }
+    vector<int> expected = input;
+    stable_sort(expected.begin(), expected.end());
+
+    vector<int> arr = input;
+    Result buffered = measure([&] { bufferedMergeSort(arr.data(), n); });
+    bool ok = arr == expected;
+    arr = input;
+    Result inPlace = measure([&] { inPlaceMergeSort(arr.data(), n); });
+    ok = ok && arr == expected;
+
+    cout << n << "\t" << buffered.seconds << "\t" << buffered.peakExtraBytes << "\t" << inPlace.seconds << "\t"
+         << inPlace.peakExtraBytes << "\t" << inPlace.seconds / buffered.seconds;
+    if (n <= baselineLimit) {
+        arr = input;
+        Result vectors = measure([&] { mergeSort(arr, 0, n - 1); });
+        ok = ok && arr == expected;
+        cout << "\t" << vectors.seconds << "\t" << vectors.peakExtraBytes;
+    }
+    cout << (ok ? "" : "\tMISMATCH") << endl;
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    // The per-merge-vector version is skipped above this size if given
+    int baselineLimit = argc > 1 ? atoi(argv[1]) : 10000000;
+    int sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+    cout << "Size\tbuffered (s)\tbuffered bytes\tin-place (s)\tin-place bytes\tslowdown\tmergeSort (s)\tmergeSort bytes"
+         << endl;
+    for (int size : sizes) {
+        measureExecutionTime(size, baselineLimit);
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+#ifndef MERGE_SORT_HPP
+#define MERGE_SORT_HPP
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+// Generic stable merge sort shared by the Lab-3 drivers:
+//
+//     merge_sort(first, last);                          // ascending by operator<
+//     merge_sort(first, last, greater<>());             // any strict weak order
+//     merge_sort(first, last, less<>(), &Record::key);  // sort records by a member
+//
+// Works on any random-access range. Elements are only ever moved, so
+// move-only types sort too. The comparator and projection are template
+// parameters and are inlined like a hand-written `<`. One buffer of n/2
+// uninitialized elements is allocated per call; each merge moves its left
+// half there and merges back into the range.
+
+namespace merge_sort_detail {
+
+// Projection that returns its argument unchanged (std::identity is C++20)
+struct identity {
+    template <typename T>
+    T &&operator()(T &&t) const noexcept {
+        return std::forward<T>(t);
+    }
+};
+
+// comp applied to the projected values
+template <typename Comp, typename Proj>
+struct projected_less {
+    Comp comp;
+    Proj proj;
+
+    template <typename A, typename B>
+    bool operator()(A &&a, B &&b) {
+        return std::invoke(comp, std::invoke(proj, std::forward<A>(a)), std::invoke(proj, std::forward<B>(b)));
+    }
+};
+
+const std::ptrdiff_t INSERTION_CUTOFF = 16;
+
+template <typename It, typename Less>
+void insertion_sort(It first, It last, Less &less) {
+    for (It i = first + 1; i < last; ++i) {
+        if (!less(*i, *(i - 1)))
+            continue;
+        auto key = std::move(*i);
+        It j = i;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j > first && less(key, *(j - 1)));
+        *j = std::move(key);
+    }
+}
+
+// Merges [first, mid) and [mid, last); buf has room for mid - first elements.
+// Right elements go first only when strictly less, which keeps it stable.
+template <typename It, typename T, typename Less>
+void merge_adjacent(It first, It mid, It last, T *buf, Less &less) {
+    T *bufEnd = std::uninitialized_move(first, mid, buf);
+    T *i = buf;
+    It j = mid, k = first;
+    while (i < bufEnd && j < last) {
+        if (less(*j, *i))
+            *k++ = std::move(*j++);
+        else
+            *k++ = std::move(*i++);
+    }
+    std::move(i, bufEnd, k);
+    std::destroy(buf, bufEnd);
+}
+
+template <typename It, typename T, typename Less>
+void sort_range(It first, It last, T *buf, Less &less) {
+    if (last - first <= INSERTION_CUTOFF) {
+        insertion_sort(first, last, less);
+        return;
+    }
+    It mid = first + (last - first) / 2;
+    sort_range(first, mid, buf, less);
+    sort_range(mid, last, buf, less);
+    if (less(*mid, *(mid - 1))) // skip the merge when the halves are already in order
+        merge_adjacent(first, mid, last, buf, less);
+}
+
+} // namespace merge_sort_detail
+
+template <typename RandomIt, typename Comp = std::less<>, typename Proj = merge_sort_detail::identity>
+void merge_sort(RandomIt first, RandomIt last, Comp comp = Comp(), Proj proj = Proj()) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (n < 2)
+        return;
+
+    merge_sort_detail::projected_less<Comp, Proj> less{std::move(comp), std::move(proj)};
+    if (n <= merge_sort_detail::INSERTION_CUTOFF) {
+        merge_sort_detail::insertion_sort(first, last, less);
+        return;
+    }
+    std::allocator<T> alloc;
+    T *buf = alloc.allocate(n / 2);
+    merge_sort_detail::sort_range(first, last, buf, less);
+    alloc.deallocate(buf, n / 2);
+}
+
+#endif
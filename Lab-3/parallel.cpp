@@ -0,0 +1,301 @@
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+using namespace std;
+
+// Work-stealing pool. Each worker owns a deque: it pushes and pops at the
+// back (LIFO, cache-warm), idle threads steal from the front of others
+// (FIFO, the oldest and therefore largest tasks). The thread that waits on
+// a TaskGroup helps by running tasks itself, so a pool with 0 workers
+// still completes everything on the calling thread.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int workers) : stopping(false) {
+        // slot 0 belongs to the external (main) thread
+        for (int i = 0; i <= workers; ++i)
+            queues.emplace_back(new Queue);
+        for (int i = 1; i <= workers; ++i)
+            threads.emplace_back([this, i] { run(i); });
+    }
+
+    ~WorkStealingPool() {
+        stopping = true;
+        {
+            lock_guard<mutex> lock(sleepMutex);
+        }
+        wake.notify_all();
+        for (thread &t : threads)
+            t.join();
+    }
+
+    int size() const { return threads.size() + 1; }
+
+    void spawn(function<void()> task) {
+        int slot = self >= 0 && owner == this ? self : 0;
+        {
+            lock_guard<mutex> lock(queues[slot]->m);
+            queues[slot]->tasks.push_back(move(task));
+        }
+        wake.notify_one();
+    }
+
+    // Runs one pending task if there is any; used by waiting threads
+    bool tryRunOne() {
+        int slot = self >= 0 && owner == this ? self : 0;
+        function<void()> task;
+        if (popLocal(slot, task) || steal(slot, task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct Queue {
+        mutex m;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<Queue>> queues;
+    vector<thread> threads;
+    atomic<bool> stopping;
+    mutex sleepMutex;
+    condition_variable wake;
+
+    static thread_local int self;
+    static thread_local WorkStealingPool *owner;
+
+    bool popLocal(int slot, function<void()> &task) {
+        lock_guard<mutex> lock(queues[slot]->m);
+        if (queues[slot]->tasks.empty())
+            return false;
+        task = move(queues[slot]->tasks.back());
+        queues[slot]->tasks.pop_back();
+        return true;
+    }
+
+    bool steal(int slot, function<void()> &task) {
+        int n = queues.size();
+        for (int k = 1; k < n; ++k) {
+            Queue &victim = *queues[(slot + k) % n];
+            lock_guard<mutex> lock(victim.m);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run(int slot) {
+        self = slot;
+        owner = this;
+        while (!stopping) {
+            if (!tryRunOne()) {
+                unique_lock<mutex> lock(sleepMutex);
+                wake.wait_for(lock, chrono::milliseconds(1));
+            }
+        }
+    }
+};
+
+thread_local int WorkStealingPool::self = -1;
+thread_local WorkStealingPool *WorkStealingPool::owner = nullptr;
+
+// Fork-join scope: run() forks a task, wait() helps until all have finished
+class TaskGroup {
+public:
+    explicit TaskGroup(WorkStealingPool &pool) : pool(pool), pending(0) {}
+    ~TaskGroup() { wait(); }
+
+    void run(function<void()> f) {
+        ++pending;
+        pool.spawn([this, f] {
+            f();
+            --pending;
+        });
+    }
+
+    void wait() {
+        while (pending > 0) {
+            if (!pool.tryRunOne())
+                this_thread::yield();
+        }
+    }
+
+private:
+    WorkStealingPool &pool;
+    atomic<int> pending;
+};
+
+// Merges a[0..na) and b[0..nb) into out, a before b on equal keys
+template <typename T>
+void sequentialMerge(const T *a, size_t na, const T *b, size_t nb, T *out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (a[i] <= b[j])
+            out[k++] = a[i++];
+        else
+            out[k++] = b[j++];
+    }
+    while (i < na)
+        out[k++] = a[i++];
+    while (j < nb)
+        out[k++] = b[j++];
+}
+
+// Co-ranking: how many of the first k merged outputs come from a. Binary
+// search for the split where a[i-1] <= b[j] and b[j-1] < a[i], which keeps
+// equal keys from a ahead of those from b (stable).
+template <typename T>
+size_t coRank(size_t k, const T *a, size_t na, const T *b, size_t nb) {
+    size_t lo = k > nb ? k - nb : 0;
+    size_t hi = min(k, na);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (j > 0 && i < na && b[j - 1] >= a[i])
+            lo = i + 1; // take more from a
+        else
+            hi = i;
+    }
+    return lo;
+}
+
+// Divide-and-conquer merge: split the output at its midpoint with coRank,
+// merge the two halves as independent tasks
+template <typename T>
+void parallelMerge(WorkStealingPool &pool, const T *a, size_t na, const T *b, size_t nb, T *out, size_t grain) {
+    size_t n = na + nb;
+    if (n <= grain) {
+        sequentialMerge(a, na, b, nb, out);
+        return;
+    }
+    size_t k = n / 2;
+    size_t i = coRank(k, a, na, b, nb);
+    size_t j = k - i;
+    TaskGroup group(pool);
+    group.run([&pool, a, i, b, j, out, grain] {
+        parallelMerge(pool, a, i, b, j, out, grain);
+    });
+    parallelMerge(pool, a + i, na - i, b + j, nb - j, out + k, grain);
+    group.wait();
+}
+
+// Sequential ping-pong merge sort (see scratch.cpp): sorts dst[lo..hi),
+// src holds the same data and is used as the other buffer
+template <typename T>
+void sequentialSort(T *src, T *dst, size_t lo, size_t hi) {
+    if (hi - lo <= 16) {
+        for (size_t i = lo + 1; i < hi; ++i) {
+            T key = dst[i];
+            size_t j = i;
+            while (j > lo && dst[j - 1] > key) {
+                dst[j] = dst[j - 1];
+                --j;
+            }
+            dst[j] = key;
+        }
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    sequentialSort(dst, src, lo, mid);
+    sequentialSort(dst, src, mid, hi);
+    sequentialMerge(src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+}
+
+// Same recursion, with the left half forked as a task down to the grain
+template <typename T>
+void parallelSort(WorkStealingPool &pool, T *src, T *dst, size_t lo, size_t hi, size_t grain) {
+    if (hi - lo <= grain) {
+        sequentialSort(src, dst, lo, hi);
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    TaskGroup group(pool);
+    group.run([&pool, src, dst, lo, mid, grain] {
+        parallelSort(pool, dst, src, lo, mid, grain);
+    });
+    parallelSort(pool, dst, src, mid, hi, grain);
+    group.wait();
+    parallelMerge(pool, src + lo, mid - lo, src + mid, hi - mid, dst + lo, grain);
+}
+
+template <typename T>
+void parallelMergeSort(WorkStealingPool &pool, T *arr, size_t n, size_t grain = 1 << 14) {
+    if (n < 2)
+        return;
+    T *scratch = new T[n];
+    copy(arr, arr + n, scratch);
+    parallelSort(pool, scratch, arr, 0, n, grain);
+    delete[] scratch;
+}
+
+template <typename T>
+T randomValue();
+
+template <>
+int randomValue<int>() { return rand(); }
+
+template <>
+double randomValue<double>() { return (rand() - RAND_MAX / 2) / (double)RAND_MAX * 1000.0; }
+
+// Strong scaling: the same input sorted with 1..maxThreads threads
+template <typename T>
+void measureScaling(const string &type, size_t n, int maxThreads) {
+    vector<T> input(n);
+    for (size_t i = 0; i < n; ++i)
+        input[i] = randomValue<T>();
+    vector<T> expected = input;
+    sort(expected.begin(), expected.end());
+
+    double base = 0;
+    for (int t = 1; t <= maxThreads; ++t) {
+        WorkStealingPool pool(t - 1);
+        vector<T> arr = input;
+        auto start = chrono::high_resolution_clock::now();
+        parallelMergeSort(pool, arr.data(), n);
+        auto end = chrono::high_resolution_clock::now();
+        double seconds = chrono::duration<double>(end - start).count();
+        if (t == 1)
+            base = seconds;
+        cout << type << "\t" << n << "\t" << t << "\t" << seconds << "\t" << base / seconds
+             << (arr == expected ? "" : "\tMISMATCH") << endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    // Usage: parallel [--threads N] [size ...]
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            maxThreads = atoi(argv[++i]);
+        else
+            sizes.push_back(strtoull(argv[i], nullptr, 10));
+    }
+    if (sizes.empty())
+        sizes.push_back(10000000);
+
+    cout << "Type\tSize\tThreads\tTime (s)\tSpeedup" << endl;
+    for (size_t n : sizes) {
+        measureScaling<int>("int", n, maxThreads);
+        measureScaling<double>("double", n, maxThreads);
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+// The merge merge.cpp had before it moved to merge_sort.hpp, kept as the
+// baseline: it allocates L and R on every call, which the single scratch
+// buffer below avoids
+void merge(vector<int> &arr, int l, int m, int r){
+    int n1 = m - l + 1;
+    int n2 = r - m;
+    vector<int> L(n1), R(n2);
+    for(int i = 0; i < n1; i++){
+        L[i] = arr[l + i];
+    }
+    for(int j = 0; j < n2; j++){
+        R[j] = arr[m + 1 + j];
+    }
+    int i = 0; int j = 0; int k = l;
+    while(i < n1 && j < n2){
+        if(L[i]<=R[j]){
+            arr[k] = L[i]; i++;
+        }else{
+            arr[k] = R[j]; j++;
+        }
+        k++;
+    }
+    while(i < n1){
+        arr[k] = L[i]; i++;k++;
+    }
+    while(j < n2){
+        arr[k] = R[j]; j++; k++;
+    }
+}
+
+void mergeSort(vector<int> &arr, int l, int r){
+    if(l < r){
+        int m = l + (r - l) / 2;
+        mergeSort(arr, l, m);
+        mergeSort(arr, m+1, r);
+        merge(arr, l, m, r);
+    }
+}
+
+// Merges src[lo..mid) and src[mid..hi) into dst[lo..hi)
+void mergeInto(const int src[], int dst[], int lo, int mid, int hi) {
+    int i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        if (src[i] <= src[j])
+            dst[k++] = src[i++];
+        else
+            dst[k++] = src[j++];
+    }
+    while (i < mid)
+        dst[k++] = src[i++];
+    while (j < hi)
+        dst[k++] = src[j++];
+}
+
+// Sorts dst[lo..hi) using src as the other buffer. Both start with the same
+// contents; each level sorts its halves into src and merges them back into
+// dst, so the roles swap every level and no copy-back pass is needed.
+void pingPongSort(int src[], int dst[], int lo, int hi) {
+    if (hi - lo <= 16) {
+        // Untouched leaf: dst still holds the input here, sort it in place
+        for (int i = lo + 1; i < hi; ++i) {
+            int key = dst[i];
+            int j = i - 1;
+            while (j >= lo && dst[j] > key) {
+                dst[j + 1] = dst[j];
+                --j;
+            }
+            dst[j + 1] = key;
+        }
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    pingPongSort(dst, src, lo, mid);
+    pingPongSort(dst, src, mid, hi);
+    mergeInto(src, dst, lo, mid, hi);
+}
+
+// Merge sort with one n-sized scratch buffer allocated up front
+void scratchMergeSort(int arr[], int n) {
+    if (n < 2)
+        return;
+    int *scratch = new int[n];
+    copy(arr, arr + n, scratch);
+    pingPongSort(scratch, arr, 0, n);
+    delete[] scratch;
+}
+
+// Measure execution time
+void measureExecutionTime(int n, int baselineLimit) {
+    vector<int> input(n);
+    for (int i = 0; i < n; ++i) {
+        input[i] = rand() % 100;
+    }
+    vector<int> expected = input;
+    sort(expected.begin(), expected.end());
+    double tn = n * log2(n);
+
+    vector<int> arr = input;
+    clock_t start = clock();
+    scratchMergeSort(arr.data(), n);
+    clock_t end = clock();
+    double scratchTime = double(end - start) / CLOCKS_PER_SEC;
+    if (arr != expected)
+        cout << "MISMATCH: scratch merge sort" << endl;
+
+    cout << "Size: " << n << ", T(n): " << tn << ", scratch t(n): " << scratchTime << " seconds";
+    if (n <= baselineLimit) {
+        arr = input;
+        start = clock();
+        mergeSort(arr, 0, n - 1);
+        end = clock();
+        double baseTime = double(end - start) / CLOCKS_PER_SEC;
+        if (arr != expected)
+            cout << " MISMATCH: vector merge sort";
+        cout << ", vector L/R t(n): " << baseTime << " seconds (" << baseTime / scratchTime << "x)";
+    }
+    cout << endl;
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    // The per-merge-vector version is skipped above this size if given
+    int baselineLimit = argc > 1 ? atoi(argv[1]) : 100000000;
+    int sizes[] = {10, 100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 10000000, 100000000};
+    for (int size : sizes) {
+        measureExecutionTime(size, baselineLimit);
+    }
+    return 0;
+}
@@ -0,0 +1,384 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+// Baseline string merge sort: alphatime.cpp's original L/R-copy merge, which
+// the reference-sorting engines below are timed against
+void merge(vector<string>& arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+    vector<string> L(n1), R(n2);
+
+    for (int i = 0; i < n1; ++i)
+        L[i] = arr[left + i];
+    for (int j = 0; j < n2; ++j)
+        R[j] = arr[mid + 1 + j];
+
+    int i = 0, j = 0, k = left;
+    while (i < n1 && j < n2) {
+        if (L[i] <= R[j]) {
+            arr[k] = L[i];
+            ++i;
+        } else {
+            arr[k] = R[j];
+            ++j;
+        }
+        ++k;
+    }
+
+    while (i < n1) {
+        arr[k] = L[i];
+        ++i;
+        ++k;
+    }
+
+    while (j < n2) {
+        arr[k] = R[j];
+        ++j;
+        ++k;
+    }
+}
+
+// Merge Sort function for strings
+void mergeSort(vector<string>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSort(arr, left, mid);
+        mergeSort(arr, mid + 1, right);
+        merge(arr, left, mid, right);
+    }
+}
+
+enum StringSortAlgorithm { MSD_RADIX, MULTIKEY_QUICKSORT, BURSTSORT };
+
+// The engines sort lightweight references and never touch the strings
+struct StrRef {
+    const char* s;
+    size_t len;
+    size_t index;
+};
+
+// Character at depth d shifted by one, 0 meaning "string ended": that makes
+// shorter strings sort before their extensions
+inline int charAt(const StrRef& r, size_t d) {
+    return d < r.len ? (unsigned char)r.s[d] + 1 : 0;
+}
+
+// Compares from depth d on, the first d characters being known equal
+inline bool lessFrom(const StrRef& a, const StrRef& b, size_t d) {
+    size_t n = min(a.len, b.len);
+    if (d < n) {
+        int c = memcmp(a.s + d, b.s + d, n - d);
+        if (c != 0)
+            return c < 0;
+    }
+    return a.len < b.len;
+}
+
+void insertionSort(StrRef* a, size_t n, size_t d) {
+    for (size_t i = 1; i < n; ++i) {
+        StrRef key = a[i];
+        size_t j = i;
+        while (j > 0 && lessFrom(key, a[j - 1], d)) {
+            a[j] = a[j - 1];
+            --j;
+        }
+        a[j] = key;
+    }
+}
+
+// Multikey quicksort (three-way radix quicksort): partition on one
+// character into <, =, > and only the = part advances to the next
+// character, so shared prefixes are scanned once per partition level
+void multikeyQuicksort(StrRef* a, size_t n, size_t d) {
+    while (n > 16) {
+        int p1 = charAt(a[0], d), p2 = charAt(a[n / 2], d), p3 = charAt(a[n - 1], d);
+        int pivot = max(min(p1, p2), min(max(p1, p2), p3));
+
+        size_t lt = 0, i = 0, gt = n;
+        while (i < gt) {
+            int c = charAt(a[i], d);
+            if (c < pivot)
+                swap(a[lt++], a[i++]);
+            else if (c > pivot)
+                swap(a[i], a[--gt]);
+            else
+                ++i;
+        }
+        multikeyQuicksort(a, lt, d);
+        multikeyQuicksort(a + gt, n - gt, d);
+        if (pivot == 0)
+            return; // the = part are identical, finished strings
+        a += lt;
+        n = gt - lt;
+        ++d;
+    }
+    insertionSort(a, n, d);
+}
+
+// MSD radix sort: one counting pass per character position distributes
+// into 257 buckets (bucket 0 = ended strings, already equal), small
+// buckets are handed to multikey quicksort
+void msdRadixSort(StrRef* a, StrRef* aux, size_t n, size_t d) {
+    if (n < 64) {
+        multikeyQuicksort(a, n, d);
+        return;
+    }
+    size_t count[258];
+    for (;;) {
+        memset(count, 0, sizeof(count));
+        for (size_t i = 0; i < n; ++i)
+            ++count[charAt(a[i], d) + 1];
+        // Whole range in one bucket (a shared prefix): skip the
+        // distribution and move on to the next character
+        int first = charAt(a[0], d);
+        if (count[first + 1] != n)
+            break;
+        if (first == 0)
+            return;
+        ++d;
+    }
+    for (int c = 0; c < 257; ++c)
+        count[c + 1] += count[c];
+    for (size_t i = 0; i < n; ++i)
+        aux[count[charAt(a[i], d)]++] = a[i];
+    memcpy(a, aux, n * sizeof(StrRef));
+
+    // count[c] is now the end of bucket c
+    size_t start = count[0];
+    for (int c = 1; c < 257; ++c) {
+        size_t end = count[c];
+        if (end - start > 1)
+            msdRadixSort(a + start, aux, end - start, d + 1);
+        start = end;
+    }
+}
+
+// Burstsort-style sort: strings are inserted into a trie whose leaves are
+// small buckets. A bucket that grows past BURST_LIMIT is burst into a new
+// trie node one character deeper, so buckets stay cache-sized and are only
+// sorted (with multikey quicksort) when the trie is walked at the end.
+class BurstTrie {
+public:
+    static const size_t BURST_LIMIT = 8192;
+
+    ~BurstTrie() { destroy(root); }
+
+    void insert(const StrRef& r) {
+        Node* node = root;
+        size_t d = 0;
+        for (;;) {
+            int c = charAt(r, d);
+            Slot& slot = node->slots[c];
+            if (slot.child) {
+                node = slot.child;
+                ++d;
+                continue;
+            }
+            slot.bucket.push_back(r);
+            if (c != 0 && slot.bucket.size() > BURST_LIMIT)
+                burst(slot, d + 1);
+            return;
+        }
+    }
+
+    // Writes the sorted references to out
+    void collect(StrRef* out) {
+        size_t k = 0;
+        collect(root, 0, out, k);
+    }
+
+private:
+    struct Node;
+    struct Slot {
+        Node* child = nullptr;
+        vector<StrRef> bucket;
+    };
+    struct Node {
+        Slot slots[257];
+    };
+
+    Node* root = new Node;
+
+    void burst(Slot& slot, size_t d) {
+        Node* node = new Node;
+        for (const StrRef& r : slot.bucket) {
+            Slot& target = node->slots[charAt(r, d)];
+            target.bucket.push_back(r);
+        }
+        vector<StrRef>().swap(slot.bucket);
+        slot.child = node;
+        // A new bucket can still be oversized when all strings share the
+        // next character; burst it again
+        for (int c = 1; c < 257; ++c)
+            if (node->slots[c].bucket.size() > BURST_LIMIT)
+                burst(node->slots[c], d + 1);
+    }
+
+    void collect(Node* node, size_t d, StrRef* out, size_t& k) {
+        for (int c = 0; c < 257; ++c) {
+            Slot& slot = node->slots[c];
+            if (slot.child) {
+                collect(slot.child, d + 1, out, k);
+                continue;
+            }
+            size_t n = slot.bucket.size();
+            if (n == 0)
+                continue;
+            memcpy(out + k, slot.bucket.data(), n * sizeof(StrRef));
+            if (c != 0)
+                multikeyQuicksort(out + k, n, d + 1);
+            k += n;
+        }
+    }
+
+    void destroy(Node* node) {
+        for (Slot& slot : node->slots)
+            if (slot.child)
+                destroy(slot.child);
+        delete node;
+    }
+};
+
+// One entry point for all engines: sorts references, then moves every
+// string once into its final position
+void stringSort(vector<string>& arr, StringSortAlgorithm algorithm) {
+    size_t n = arr.size();
+    vector<StrRef> refs(n);
+    for (size_t i = 0; i < n; ++i)
+        refs[i] = StrRef{arr[i].data(), arr[i].size(), i};
+
+    if (algorithm == MSD_RADIX) {
+        vector<StrRef> aux(n);
+        msdRadixSort(refs.data(), aux.data(), n, 0);
+    } else if (algorithm == MULTIKEY_QUICKSORT) {
+        multikeyQuicksort(refs.data(), n, 0);
+    } else {
+        BurstTrie trie;
+        for (const StrRef& r : refs)
+            trie.insert(r);
+        trie.collect(refs.data());
+    }
+
+    vector<string> sorted(n);
+    for (size_t i = 0; i < n; ++i)
+        sorted[i] = move(arr[refs[i].index]);
+    arr.swap(sorted);
+}
+
+string randomString(int len) {
+    static const char alphanum[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    string str;
+    for (int j = 0; j < len; ++j)
+        str += alphanum[rand() % (sizeof(alphanum) - 1)];
+    return str;
+}
+
+// Random 5-char strings, as in alphatime.cpp
+vector<string> generateRandom(int n) {
+    vector<string> arr(n);
+    for (int i = 0; i < n; ++i)
+        arr[i] = randomString(5);
+    return arr;
+}
+
+// Long shared prefixes, like URLs or file paths
+vector<string> generateSharedPrefix(int n) {
+    static const char* prefixes[] = {
+        "https://www.example.com/users/profile/settings/",
+        "https://www.example.com/users/profile/history/",
+        "https://www.example.com/products/catalog/item/",
+    };
+    vector<string> arr(n);
+    for (int i = 0; i < n; ++i)
+        arr[i] = prefixes[rand() % 3] + randomString(8);
+    return arr;
+}
+
+// Natural-language-like words. Uses a word list when one is given (one word
+// per line, e.g. /usr/share/dict/words); otherwise builds pseudo-words from
+// syllables. Either way words are drawn with a Zipf distribution, so the
+// output has the heavy duplication of real text.
+vector<string> generateWords(int n, const vector<string>& dictionary) {
+    vector<string> vocabulary = dictionary;
+    if (vocabulary.empty()) {
+        static const char* syllables[] = {"the", "an", "ing", "er", "re", "on", "at", "en", "ti", "es",
+                                          "or", "te", "of", "ed", "is", "it", "al", "ar", "st", "to",
+                                          "nt", "ha", "nd", "ou", "ea", "ng", "as", "se", "hi", "le"};
+        for (int i = 0; i < 50000; ++i) {
+            string w;
+            int parts = 1 + rand() % 4;
+            for (int p = 0; p < parts; ++p)
+                w += syllables[rand() % 30];
+            vocabulary.push_back(w);
+        }
+    }
+    vector<double> cdf(vocabulary.size());
+    double total = 0;
+    for (size_t r = 0; r < vocabulary.size(); ++r) {
+        total += 1.0 / (r + 1);
+        cdf[r] = total;
+    }
+    vector<string> arr(n);
+    for (int i = 0; i < n; ++i) {
+        double u = (double)rand() / RAND_MAX * total;
+        size_t r = lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+        arr[i] = vocabulary[min(r, vocabulary.size() - 1)];
+    }
+    return arr;
+}
+
+template <typename SortFn>
+double timeSort(const vector<string>& input, const vector<string>& expected, SortFn sortFn) {
+    vector<string> arr = input;
+    auto start = chrono::high_resolution_clock::now();
+    sortFn(arr);
+    auto end = chrono::high_resolution_clock::now();
+    if (arr != expected)
+        cout << " MISMATCH";
+    chrono::duration<double> duration = end - start;
+    return duration.count();
+}
+
+// Measure execution time
+void measureExecutionTime(const string& kind, const vector<string>& input) {
+    vector<string> expected = input;
+    sort(expected.begin(), expected.end());
+
+    cout << kind << ", Size: " << input.size();
+    cout << ", mergeSort: " << timeSort(input, expected, [](vector<string>& v) { mergeSort(v, 0, v.size() - 1); });
+    cout << ", std::sort: " << timeSort(input, expected, [](vector<string>& v) { sort(v.begin(), v.end()); });
+    cout << ", MSD radix: " << timeSort(input, expected, [](vector<string>& v) { stringSort(v, MSD_RADIX); });
+    cout << ", multikey: " << timeSort(input, expected, [](vector<string>& v) { stringSort(v, MULTIKEY_QUICKSORT); });
+    cout << ", burst: " << timeSort(input, expected, [](vector<string>& v) { stringSort(v, BURSTSORT); });
+    cout << " seconds" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    srand(time(0));
+    // Optional word list for the natural-language input
+    vector<string> dictionary;
+    if (argc > 1) {
+        ifstream in(argv[1]);
+        string w;
+        while (in >> w)
+            dictionary.push_back(w);
+    }
+
+    int sizes[] = {10000, 100000, 1000000};
+    for (int size : sizes) {
+        measureExecutionTime("random", generateRandom(size));
+        measureExecutionTime("shared-prefix", generateSharedPrefix(size));
+        measureExecutionTime("words", generateWords(size, dictionary));
+    }
+    return 0;
+}
@@ -2,64 +2,105 @@
 #include <ctime>
 #include <cstdlib>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "merge_sort.hpp"
 
 using namespace std;
 
-// Merge function
-void merge(int arr[], int p, int q, int r) {
-    int n1 = q - p + 1;
-    int n2 = r - q;
-    int L[n1], M[n2];
-
-    for (int i = 0; i < n1; i++)
-        L[i] = arr[p + i];
-    for (int j = 0; j < n2; j++)
-        M[j] = arr[q + 1 + j];
-
-    int i = 0, j = 0, k = p;
-    while (i < n1 && j < n2) {
-        if (L[i] <= M[j]) {
-            arr[k] = L[i];
-            i++;
-        } else {
-            arr[k] = M[j];
-            j++;
-        }
-        k++;
-    }
+// Order-preserving unsigned keys: flipping the sign bit of an int makes
+// negatives sort first; for an IEEE-754 double, negatives get every bit
+// flipped (reversing their order) and positives only the sign bit
+inline uint32_t radixKey(int x) {
+    return (uint32_t)x ^ 0x80000000u;
+}
 
-    while (i < n1) {
-        arr[k] = L[i];
-        i++;
-        k++;
+inline uint64_t radixKey(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : bits ^ 0x8000000000000000ull;
+}
+
+// LSD radix sort, O(n * w): 8-bit digits for int (4 passes), 11-bit digits
+// for double (6 passes). All histograms are built in one read pass, and a
+// pass whose digit is the same for every key is skipped.
+template <typename T, int DigitBits>
+void radixSort(T arr[], int n) {
+    typedef decltype(radixKey(T())) Key;
+    const int passes = (sizeof(Key) * 8 + DigitBits - 1) / DigitBits;
+    const int buckets = 1 << DigitBits;
+    const Key mask = buckets - 1;
+    if (n < 2)
+        return;
+
+    vector<size_t> count(passes * buckets, 0);
+    for (int i = 0; i < n; ++i) {
+        Key k = radixKey(arr[i]);
+        for (int p = 0; p < passes; ++p)
+            ++count[p * buckets + ((k >> (p * DigitBits)) & mask)];
     }
 
-    while (j < n2) {
-        arr[k] = M[j];
-        j++;
-        k++;
+    T* buf = new T[n];
+    T* src = arr;
+    T* dst = buf;
+    for (int p = 0; p < passes; ++p) {
+        size_t* c = &count[p * buckets];
+        Key first = (radixKey(src[0]) >> (p * DigitBits)) & mask;
+        if (c[first] == (size_t)n)
+            continue; // every key has the same digit here
+        size_t sum = 0;
+        for (int b = 0; b < buckets; ++b) {
+            size_t t = c[b];
+            c[b] = sum;
+            sum += t;
+        }
+        for (int i = 0; i < n; ++i)
+            dst[c[(radixKey(src[i]) >> (p * DigitBits)) & mask]++] = src[i];
+        swap(src, dst);
     }
+    if (src != arr)
+        memcpy(arr, src, n * sizeof(T));
+    delete[] buf;
 }
 
-// Merge Sort function
-void mergeSort(int arr[], int l, int r) {
-    if (l < r) {
-        int m = l + (r - l) / 2;
-        mergeSort(arr, l, m);
-        mergeSort(arr, m + 1, r);
-        merge(arr, l, m, r);
-    }
+void radixSort(int arr[], int n) {
+    radixSort<int, 8>(arr, n);
+}
+
+void radixSort(double arr[], int n) {
+    radixSort<double, 11>(arr, n);
+}
+
+template <typename T>
+T randomValue();
+
+template <>
+int randomValue<int>() { return rand() % 100; }
+
+template <>
+double randomValue<double>() { return (rand() - RAND_MAX / 2) / (double)RAND_MAX * 1000.0; }
+
+template <typename T>
+void sortWith(const string& algorithm, T arr[], int n) {
+    if (algorithm == "radix")
+        radixSort(arr, n);
+    else
+        merge_sort(arr, arr + n);
 }
 
 // Measure execution time
-void measureExecutionTime(int n) {
-    int* arr = new int[n];
+template <typename T>
+void measureExecutionTime(int n, const string& algorithm) {
+    T* arr = new T[n];
     for (int i = 0; i < n; ++i) {
-        arr[i] = rand() % 100;
+        arr[i] = randomValue<T>();
     }
 
     clock_t start = clock();
-    mergeSort(arr, 0, n - 1);
+    sortWith(algorithm, arr, n);
     clock_t end = clock();
 
     double duration = double(end - start) / CLOCKS_PER_SEC;
@@ -69,11 +110,63 @@ void measureExecutionTime(int n) {
     delete[] arr;
 }
 
-int main() {
+// Average seconds per sort of n random values, repeated to ~10^6 elements
+template <typename T>
+double averageTime(const string& algorithm, int n) {
+    int reps = max(1, 1000000 / n);
+    vector<T> input(n), arr(n);
+    for (int i = 0; i < n; ++i)
+        input[i] = randomValue<T>();
+    double total = 0;
+    for (int r = 0; r < reps; ++r) {
+        arr = input;
+        auto start = chrono::high_resolution_clock::now();
+        sortWith(algorithm, arr.data(), n);
+        auto end = chrono::high_resolution_clock::now();
+        total += chrono::duration<double>(end - start).count();
+    }
+    return total / reps;
+}
+
+// Merge vs radix side by side, and the first size where radix wins
+template <typename T>
+void crossover(const string& type) {
+    int sizes[] = {8, 16, 32, 64, 128, 256, 512, 1024, 4096, 16384, 65536, 262144, 1048576};
+    int winsFrom = -1;
+    cout << type << "\nSize\tmerge t(n)\tradix t(n)" << endl;
+    for (int n : sizes) {
+        double m = averageTime<T>("merge", n);
+        double r = averageTime<T>("radix", n);
+        cout << n << "\t" << m << "\t" << r << endl;
+        if (r < m && winsFrom < 0)
+            winsFrom = n;
+        else if (r >= m)
+            winsFrom = -1;
+    }
+    if (winsFrom > 0)
+        cout << "Radix sort is faster from n = " << winsFrom << endl;
+    else
+        cout << "Radix sort is not faster at the largest size" << endl;
+}
+
+int main(int argc, char* argv[]) {
     srand(time(0));
+    // Usage: time [merge|radix|crossover] [int|double]
+    string algorithm = argc > 1 ? argv[1] : "merge";
+    string type = argc > 2 ? argv[2] : "int";
+
+    if (algorithm == "crossover") {
+        crossover<int>("int");
+        crossover<double>("double");
+        return 0;
+    }
+
     int sizes[] = {10, 100,500, 1000, 5000,10000, 50000,100000,500000,1000000};
     for (int size : sizes) {
-        measureExecutionTime(size);
+        if (type == "double")
+            measureExecutionTime<double>(size, algorithm);
+        else
+            measureExecutionTime<int>(size, algorithm);
     }
     return 0;
 }
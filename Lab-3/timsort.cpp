@@ -0,0 +1,419 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+// Reference sort for the benchmark: the top-down merge sort from merge.cpp
+// before merge_sort.hpp, which splits at the midpoint whatever runs exist
+void merge(vector<int> &arr, int l, int m, int r){
+    int n1 = m - l + 1;
+    int n2 = r - m;
+    vector<int> L(n1), R(n2);
+    for(int i = 0; i < n1; i++){
+        L[i] = arr[l + i];
+    }
+    for(int j = 0; j < n2; j++){
+        R[j] = arr[m + 1 + j];
+    }
+    int i = 0; int j = 0; int k = l;
+    while(i < n1 && j < n2){
+        if(L[i]<=R[j]){
+            arr[k] = L[i]; i++;
+        }else{
+            arr[k] = R[j]; j++;
+        }
+        k++;
+    }
+    while(i < n1){
+        arr[k] = L[i]; i++;k++;
+    }
+    while(j < n2){
+        arr[k] = R[j]; j++; k++;
+    }
+}
+
+void mergeSort(vector<int> &arr, int l, int r){
+    if(l < r){
+        int m = l + (r - l) / 2;
+        mergeSort(arr, l, m);
+        mergeSort(arr, m+1, r);
+        merge(arr, l, m, r);
+    }
+}
+
+// Natural merge sort in the style of TimSort. Existing ascending runs (and
+// strictly descending ones, reversed in place) are found in one scan; short
+// runs are extended to minRun with binary insertion sort. Runs go on a stack
+// that is kept balanced so every merge joins runs of similar length, and
+// merges switch to galloping when one side keeps winning.
+class NaturalMergeSort {
+public:
+    void sort(int arr[], int n) {
+        a = arr;
+        minGallop = MIN_GALLOP;
+        runBase.clear();
+        runLen.clear();
+        if (n < 2)
+            return;
+        if (n < MIN_MERGE) {
+            int run = countRunAndMakeAscending(0, n);
+            binaryInsertionSort(0, n, run);
+            return;
+        }
+
+        int minRun = computeMinRun(n);
+        int lo = 0, remaining = n;
+        do {
+            int run = countRunAndMakeAscending(lo, n);
+            if (run < minRun) {
+                int force = min(remaining, minRun);
+                binaryInsertionSort(lo, lo + force, lo + run);
+                run = force;
+            }
+            runBase.push_back(lo);
+            runLen.push_back(run);
+            mergeCollapse();
+            lo += run;
+            remaining -= run;
+        } while (remaining != 0);
+        mergeForceCollapse();
+    }
+
+private:
+    static const int MIN_MERGE = 64;
+    static const int MIN_GALLOP = 7;
+
+    int *a;
+    int minGallop;
+    vector<int> tmp;
+    vector<int> runBase, runLen;
+
+    // n itself below 64, otherwise a value in [32, 64] such that n / minRun
+    // is a power of two or slightly less, so the final merges are balanced
+    static int computeMinRun(int n) {
+        int r = 0;
+        while (n >= MIN_MERGE) {
+            r |= n & 1;
+            n >>= 1;
+        }
+        return n + r;
+    }
+
+    // Length of the run starting at lo; a strictly descending run is
+    // reversed (strictly, so equal elements never swap and the sort stays stable)
+    int countRunAndMakeAscending(int lo, int hi) {
+        int runHi = lo + 1;
+        if (runHi == hi)
+            return 1;
+        if (a[runHi++] < a[lo]) {
+            while (runHi < hi && a[runHi] < a[runHi - 1])
+                ++runHi;
+            reverse(a + lo, a + runHi);
+        } else {
+            while (runHi < hi && a[runHi] >= a[runHi - 1])
+                ++runHi;
+        }
+        return runHi - lo;
+    }
+
+    // Sorts a[lo..hi) given that a[lo..start) is already sorted
+    void binaryInsertionSort(int lo, int hi, int start) {
+        for (int i = start; i < hi; ++i) {
+            int pivot = a[i];
+            int left = lo, right = i;
+            while (left < right) {
+                int mid = left + (right - left) / 2;
+                if (pivot < a[mid])
+                    right = mid;
+                else
+                    left = mid + 1;
+            }
+            memmove(a + left + 1, a + left, (i - left) * sizeof(int));
+            a[left] = pivot;
+        }
+    }
+
+    // Position in arr[base..base+len) before the first element >= key,
+    // searched outwards from hint in steps 1, 3, 7, ... then binary
+    static int gallopLeft(int key, const int *arr, int base, int len, int hint) {
+        int lastOfs = 0, ofs = 1;
+        if (key > arr[base + hint]) {
+            int maxOfs = len - hint;
+            while (ofs < maxOfs && key > arr[base + hint + ofs]) {
+                lastOfs = ofs;
+                ofs = ofs * 2 + 1;
+            }
+            ofs = min(ofs, maxOfs);
+            lastOfs += hint;
+            ofs += hint;
+        } else {
+            int maxOfs = hint + 1;
+            while (ofs < maxOfs && key <= arr[base + hint - ofs]) {
+                lastOfs = ofs;
+                ofs = ofs * 2 + 1;
+            }
+            ofs = min(ofs, maxOfs);
+            int t = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - t;
+        }
+        ++lastOfs;
+        while (lastOfs < ofs) {
+            int m = lastOfs + (ofs - lastOfs) / 2;
+            if (key > arr[base + m])
+                lastOfs = m + 1;
+            else
+                ofs = m;
+        }
+        return ofs;
+    }
+
+    // Like gallopLeft, but after the last element equal to key
+    static int gallopRight(int key, const int *arr, int base, int len, int hint) {
+        int lastOfs = 0, ofs = 1;
+        if (key < arr[base + hint]) {
+            int maxOfs = hint + 1;
+            while (ofs < maxOfs && key < arr[base + hint - ofs]) {
+                lastOfs = ofs;
+                ofs = ofs * 2 + 1;
+            }
+            ofs = min(ofs, maxOfs);
+            int t = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - t;
+        } else {
+            int maxOfs = len - hint;
+            while (ofs < maxOfs && key >= arr[base + hint + ofs]) {
+                lastOfs = ofs;
+                ofs = ofs * 2 + 1;
+            }
+            ofs = min(ofs, maxOfs);
+            lastOfs += hint;
+            ofs += hint;
+        }
+        ++lastOfs;
+        while (lastOfs < ofs) {
+            int m = lastOfs + (ofs - lastOfs) / 2;
+            if (key < arr[base + m])
+                ofs = m;
+            else
+                lastOfs = m + 1;
+        }
+        return ofs;
+    }
+
+    // Restores the invariants on the top of the stack:
+    //   len[n-2] > len[n-1] + len[n] and len[n-1] > len[n]
+    // (checked one run deeper too, which the original TimSort missed)
+    void mergeCollapse() {
+        while (runLen.size() > 1) {
+            int n = runLen.size() - 2;
+            if ((n > 0 && runLen[n - 1] <= runLen[n] + runLen[n + 1]) ||
+                (n > 1 && runLen[n - 2] <= runLen[n - 1] + runLen[n])) {
+                if (runLen[n - 1] < runLen[n + 1])
+                    --n;
+            } else if (runLen[n] > runLen[n + 1]) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
+
+    void mergeForceCollapse() {
+        while (runLen.size() > 1) {
+            int n = runLen.size() - 2;
+            if (n > 0 && runLen[n - 1] < runLen[n + 1])
+                --n;
+            mergeAt(n);
+        }
+    }
+
+    // Merges stack runs i and i+1. Elements of run 1 already below run 2's
+    // first element, and of run 2 already above run 1's last, stay in place.
+    void mergeAt(int i) {
+        int base1 = runBase[i], len1 = runLen[i];
+        int base2 = runBase[i + 1], len2 = runLen[i + 1];
+        runLen[i] = len1 + len2;
+        runBase.erase(runBase.begin() + i + 1);
+        runLen.erase(runLen.begin() + i + 1);
+
+        int k = gallopRight(a[base2], a, base1, len1, 0);
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0)
+            return;
+        len2 = gallopLeft(a[base1 + len1 - 1], a, base2, len2, len2 - 1);
+        if (len2 == 0)
+            return;
+        if (len1 <= len2)
+            mergeLo(base1, len1, base2, len2);
+        else
+            mergeHi(base1, len1, base2, len2);
+    }
+
+    // Forward merge with run 1 (the shorter) copied out
+    void mergeLo(int base1, int len1, int base2, int len2) {
+        tmp.assign(a + base1, a + base1 + len1);
+        int c1 = 0, c2 = base2, end2 = base2 + len2, dest = base1;
+        while (true) {
+            // One element at a time until one side wins minGallop in a row
+            int count1 = 0, count2 = 0;
+            while (c1 < len1 && c2 < end2) {
+                if (a[c2] < tmp[c1]) {
+                    a[dest++] = a[c2++];
+                    ++count2;
+                    count1 = 0;
+                    if (count2 >= minGallop)
+                        break;
+                } else {
+                    a[dest++] = tmp[c1++];
+                    ++count1;
+                    count2 = 0;
+                    if (count1 >= minGallop)
+                        break;
+                }
+            }
+            if (c1 == len1 || c2 == end2)
+                break;
+
+            // Galloping: copy whole stretches found by exponential search
+            do {
+                count1 = gallopRight(a[c2], tmp.data(), c1, len1 - c1, 0);
+                copy(tmp.begin() + c1, tmp.begin() + c1 + count1, a + dest);
+                dest += count1;
+                c1 += count1;
+                if (c1 == len1)
+                    goto done;
+                a[dest++] = a[c2++];
+                if (c2 == end2)
+                    goto done;
+
+                count2 = gallopLeft(tmp[c1], a, c2, end2 - c2, 0);
+                memmove(a + dest, a + c2, count2 * sizeof(int));
+                dest += count2;
+                c2 += count2;
+                if (c2 == end2)
+                    goto done;
+                a[dest++] = tmp[c1++];
+                if (c1 == len1)
+                    goto done;
+                --minGallop;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            minGallop = max(minGallop, 0) + 2; // penalty for leaving gallop mode
+        }
+    done:
+        // Whatever is left of run 2 is already in place
+        copy(tmp.begin() + c1, tmp.begin() + len1, a + dest);
+    }
+
+    // Backward merge with run 2 (the shorter) copied out
+    void mergeHi(int base1, int len1, int base2, int len2) {
+        tmp.assign(a + base2, a + base2 + len2);
+        int c1 = base1 + len1 - 1, c2 = len2 - 1, dest = base2 + len2 - 1;
+        while (true) {
+            int count1 = 0, count2 = 0;
+            while (c1 >= base1 && c2 >= 0) {
+                if (tmp[c2] < a[c1]) {
+                    a[dest--] = a[c1--];
+                    ++count1;
+                    count2 = 0;
+                    if (count1 >= minGallop)
+                        break;
+                } else {
+                    a[dest--] = tmp[c2--];
+                    ++count2;
+                    count1 = 0;
+                    if (count2 >= minGallop)
+                        break;
+                }
+            }
+            if (c1 < base1 || c2 < 0)
+                break;
+
+            do {
+                count1 = (c1 - base1 + 1) - gallopRight(tmp[c2], a, base1, c1 - base1 + 1, c1 - base1);
+                memmove(a + dest - count1 + 1, a + c1 - count1 + 1, count1 * sizeof(int));
+                dest -= count1;
+                c1 -= count1;
+                if (c1 < base1)
+                    goto done;
+                a[dest--] = tmp[c2--];
+                if (c2 < 0)
+                    goto done;
+
+                count2 = (c2 + 1) - gallopLeft(a[c1], tmp.data(), 0, c2 + 1, c2);
+                copy(tmp.begin() + c2 - count2 + 1, tmp.begin() + c2 + 1, a + dest - count2 + 1);
+                dest -= count2;
+                c2 -= count2;
+                if (c2 < 0)
+                    goto done;
+                a[dest--] = a[c1--];
+                if (c1 < base1)
+                    goto done;
+                --minGallop;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            minGallop = max(minGallop, 0) + 2;
+        }
+    done:
+        // Whatever is left of run 1 is already in place
+        copy(tmp.begin(), tmp.begin() + c2 + 1, a + dest - c2);
+    }
+};
+
+vector<int> generateInput(const string &kind, int n) {
+    vector<int> arr(n);
+    for (int i = 0; i < n; ++i) {
+        if (kind == "sorted")
+            arr[i] = i;
+        else if (kind == "reversed")
+            arr[i] = n - i;
+        else if (kind == "sawtooth")
+            arr[i] = i % 1000; // ascending runs of 1000
+        else
+            arr[i] = rand();
+    }
+    return arr;
+}
+
+// Measure execution time
+void measureExecutionTime(const string &kind, int n) {
+    vector<int> input = generateInput(kind, n);
+    vector<int> expected = input;
+    stable_sort(expected.begin(), expected.end());
+
+    vector<int> arr = input;
+    clock_t start = clock();
+    mergeSort(arr, 0, n - 1);
+    clock_t end = clock();
+    double mergeTime = double(end - start) / CLOCKS_PER_SEC;
+    bool mergeOk = arr == expected;
+
+    arr = input;
+    NaturalMergeSort sorter;
+    start = clock();
+    sorter.sort(arr.data(), n);
+    end = clock();
+    double naturalTime = double(end - start) / CLOCKS_PER_SEC;
+    bool naturalOk = arr == expected;
+
+    cout << kind << "\t" << n << "\t" << mergeTime << "\t" << naturalTime << "\t" << mergeTime / naturalTime
+         << (mergeOk && naturalOk ? "" : "\tMISMATCH") << endl;
+}
+
+int main() {
+    srand(time(0));
+    string kinds[] = {"random", "sorted", "reversed", "sawtooth"};
+    int sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+    cout << "Input\tSize\tmergeSort (s)\tnatural (s)\tSpeedup" << endl;
+    for (const string &kind : kinds) {
+        for (int size : sizes) {
+            measureExecutionTime(kind, size);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+using namespace std::chrono;
+
+// Per-query tabulation as in timetabu.cpp: the whole table is rebuilt for
+// every rod length
+long long rodcut(int n, const vector<int>& val) {
+    vector<long long> res(n + 1);
+    res[0] = 0;
+
+    for (int i = 1; i <= n; i++) {
+        res[i] = LLONG_MIN;
+        for (int j = 0; j < i && j < (int)val.size(); j++) {
+            res[i] = max(res[i], val[j] + res[i - (j + 1)]);
+        }
+    }
+    return res[n];
+}
+
+// Answers rod-cutting queries for one price list from a single table.
+// res[i] depends only on res[0..i), so the table built for the longest
+// query so far already answers every shorter one, and a longer query only
+// computes the missing suffix. Lengths past the price list are cut into
+// priced pieces. An empty price list or a negative rod length throws
+// invalid_argument.
+class RodCuttingService {
+public:
+    // val[j] is the price of a piece of length j + 1
+    explicit RodCuttingService(vector<int> val) : val(val), res(1, 0) {
+        if (val.empty())
+            throw invalid_argument("price list must not be empty");
+    }
+
+    long long query(int n) {
+        checkLength(n);
+        extendTo(n);
+        return res[n];
+    }
+
+    // Builds once to the longest length, then answers every query by lookup
+    vector<long long> queryAll(const vector<int>& lengths) {
+        for (int n : lengths)
+            checkLength(n);
+        if (!lengths.empty())
+            extendTo(*max_element(lengths.begin(), lengths.end()));
+        vector<long long> answers;
+        answers.reserve(lengths.size());
+        for (int n : lengths)
+            answers.push_back(res[n]);
+        return answers;
+    }
+
+    int tableLength() const { return res.size() - 1; }
+
+private:
+    vector<int> val;
+    vector<long long> res;
+
+    static void checkLength(int n) {
+        if (n < 0)
+            throw invalid_argument("rod length must be non-negative: " + to_string(n));
+    }
+
+    void extendTo(int n) {
+        int from = res.size();
+        if (n < from)
+            return;
+        res.resize(n + 1);
+        int pieces = val.size();
+        for (int i = from; i <= n; i++) {
+            long long best = LLONG_MIN;
+            for (int j = 0; j < i && j < pieces; j++) {
+                best = max(best, val[j] + res[i - (j + 1)]);
+            }
+            res[i] = best;
+        }
+    }
+};
+
+vector<int> randomPrices(int n) {
+    vector<int> val(n);
+    for (int i = 0; i < n; i++) val[i] = i + 1 + rand() % 5;
+    return val;
+}
+
+// The same batch answered by recomputing per query, by one queryAll, and
+// one query at a time on a service that grows as needed
+void compareBatch(const string& name, const vector<int>& val, const vector<int>& lengths) {
+    auto start = high_resolution_clock::now();
+    vector<long long> perQuery;
+    for (int n : lengths) perQuery.push_back(rodcut(n, val));
+    auto t1 = high_resolution_clock::now();
+    RodCuttingService batch(val);
+    vector<long long> shared = batch.queryAll(lengths);
+    auto t2 = high_resolution_clock::now();
+    RodCuttingService incremental(val);
+    vector<long long> grown;
+    for (int n : lengths) grown.push_back(incremental.query(n));
+    auto t3 = high_resolution_clock::now();
+
+    cout << name << "\t" << lengths.size() << "\t" << *max_element(lengths.begin(), lengths.end()) << "\t"
+         << duration_cast<microseconds>(t1 - start).count() << "\t"
+         << duration_cast<microseconds>(t2 - t1).count() << "\t"
+         << duration_cast<microseconds>(t3 - t2).count()
+         << (perQuery == shared && perQuery == grown ? "" : "\tMISMATCH") << endl;
+}
+
+// Reads the number of prices, the prices, then rod lengths until end of
+// input, and prints "length revenue" for each. Bad input ends with an
+// error message and status 1.
+int serveQueries() {
+    int p;
+    bool ok = cin >> p && p > 0;
+    vector<int> val(ok ? p : 0);
+    for (int i = 0; ok && i < p; i++) ok = (bool)(cin >> val[i]);
+    if (!ok) {
+        cerr << "Expected the number of prices followed by the prices" << endl;
+        return 1;
+    }
+    RodCuttingService service(val);
+    int n;
+    while (cin >> n) {
+        if (n < 0) {
+            cerr << "Skipping negative length " << n << endl;
+            continue;
+        }
+        cout << n << " " << service.query(n) << "\n";
+    }
+    if (!cin.eof()) {
+        cin.clear();
+        string token;
+        cin >> token;
+        cerr << "Expected a rod length, got \"" << token << "\"" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: batch            benchmark
+    //        batch query      prices and lengths from stdin
+    if (argc > 1 && string(argv[1]) == "query")
+        return serveQueries();
+
+    srand(time(0));
+    vector<int> val = randomPrices(50000);
+    cout << "Batch\tQueries\tMax length\tper query (us)\tqueryAll (us)\tincremental (us)" << endl;
+    compareBatch("sweep", val, {10, 100, 1000, 10000, 50000});
+
+    vector<int> randomLengths;
+    for (int i = 0; i < 100; i++) randomLengths.push_back(1 + rand() % 10000);
+    compareBatch("random", val, randomLengths);
+
+    vector<int> ascending = randomLengths;
+    sort(ascending.begin(), ascending.end());
+    compareBatch("ascending", val, ascending);
+    return 0;
+}
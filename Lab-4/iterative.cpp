@@ -0,0 +1,178 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+// Recursive memoization from timememo.cpp, kept as the reference
+int rodhelp(int n, vector<int>& val, vector<int>& re) {
+    if (n == 0) return 0;
+    if (re[n] != -1) return re[n];
+
+    int maxre = INT_MIN;
+    for (int i = 0; i < n; i++) {
+        maxre = max(maxre, val[i] + rodhelp(n - i - 1, val, re));
+    }
+
+    re[n] = maxre;
+    return maxre;
+}
+
+int rodcut(int n, vector<int>& val) {
+    vector<int> re(n + 1, -1);
+    return rodhelp(n, val, re);
+}
+
+// A piece length that has a price; lengths without one cannot be sold
+struct Piece {
+    int length;
+    long long price;
+};
+
+// Memoized rod cutting without recursion. maxRevenue(n) walks the
+// subproblems with an explicit stack of frames (length, next piece to try,
+// best so far): a frame descends into the first remainder that is not yet
+// known and resumes where it left off once that remainder is done. Only
+// lengths reachable from n by removing priced pieces are ever computed, and
+// the memo is kept between queries. A remainder shorter than every priced
+// piece is worth 0. Piece lengths must be positive and rod lengths
+// non-negative; anything else throws invalid_argument.
+class RodCutter {
+public:
+    explicit RodCutter(vector<Piece> pieces) : pieces(pieces), memo(1, 0), computed(0) {
+        for (const Piece& p : this->pieces)
+            if (p.length <= 0)
+                throw invalid_argument("piece length must be positive: " + to_string(p.length));
+        sort(this->pieces.begin(), this->pieces.end(), [](const Piece& a, const Piece& b) {
+            return a.length < b.length;
+        });
+    }
+
+    long long maxRevenue(int n) {
+        if (n < 0)
+            throw invalid_argument("rod length must be non-negative: " + to_string(n));
+        if ((int)memo.size() <= n)
+            memo.resize(n + 1, UNKNOWN);
+        if (memo[n] != UNKNOWN)
+            return memo[n];
+
+        int k = pieces.size();
+        vector<Frame> stack;
+        stack.push_back(Frame{n, 0, 0});
+        while (!stack.empty()) {
+            Frame& f = stack.back();
+            bool descended = false;
+            while (f.next < k && pieces[f.next].length <= f.length) {
+                int rest = f.length - pieces[f.next].length;
+                if (memo[rest] == UNKNOWN) {
+                    stack.push_back(Frame{rest, 0, 0}); // f is invalid from here
+                    descended = true;
+                    break;
+                }
+                f.best = max(f.best, pieces[f.next].price + memo[rest]);
+                ++f.next;
+            }
+            if (!descended) {
+                memo[f.length] = f.best;
+                ++computed;
+                stack.pop_back();
+            }
+        }
+        return memo[n];
+    }
+
+    // Number of lengths solved so far
+    size_t computedLengths() const { return computed; }
+
+private:
+    static constexpr long long UNKNOWN = -1;
+
+    struct Frame {
+        int length;
+        int next;
+        long long best;
+    };
+
+    vector<Piece> pieces;
+    vector<long long> memo;
+    size_t computed;
+};
+
+// Dense price list as in timememo.cpp: length i+1 sells for prices[i]
+vector<Piece> densePieces(const vector<int>& prices) {
+    vector<Piece> pieces;
+    for (int i = 0; i < (int)prices.size(); i++)
+        pieces.push_back(Piece{i + 1, prices[i]});
+    return pieces;
+}
+
+void compareWithRecursive() {
+    vector<int> lengths = {10, 100, 1000, 10000};
+    cout << "Dense prices (price = length)\nLength\trecursive (us)\titerative (us)\tRevenue" << endl;
+    for (int n : lengths) {
+        vector<int> prices(n);
+        for (int i = 0; i < n; i++) prices[i] = i + 1;
+
+        auto start = high_resolution_clock::now();
+        int recursive = rodcut(n, prices);
+        auto mid = high_resolution_clock::now();
+        RodCutter cutter(densePieces(prices));
+        long long iterative = cutter.maxRevenue(n);
+        auto stop = high_resolution_clock::now();
+
+        cout << n << "\t" << duration_cast<microseconds>(mid - start).count() << "\t"
+             << duration_cast<microseconds>(stop - mid).count() << "\t" << iterative
+             << (iterative == recursive ? "" : "\tMISMATCH") << endl;
+    }
+}
+
+// Plain bottom-up O(n * k) over every length 0..n, the reference for the
+// sparse runs: res[i] is the best over pieces that fit, or 0 if none does
+long long bottomUp(int n, const vector<Piece>& pieces) {
+    vector<long long> res(n + 1, 0);
+    for (int i = 1; i <= n; i++)
+        for (const Piece& p : pieces)
+            if (p.length <= i)
+                res[i] = max(res[i], p.price + res[i - p.length]);
+    return res[n];
+}
+
+// Only a few piece lengths priced: the cost is lengths reached x pieces,
+// and with long pieces only a small fraction of lengths is reached. The
+// 10^6 runs are checked against bottomUp.
+void sparseSweep(const string& name, const vector<Piece>& pieces) {
+    vector<int> lengths = {1000000, 10000000};
+    cout << name << "\nLength\tTime (us)\tLengths computed\tRevenue" << endl;
+    for (int n : lengths) {
+        RodCutter cutter(pieces);
+        auto start = high_resolution_clock::now();
+        long long revenue = cutter.maxRevenue(n);
+        auto stop = high_resolution_clock::now();
+        cout << n << "\t" << duration_cast<microseconds>(stop - start).count() << "\t"
+             << cutter.computedLengths() << "\t" << revenue;
+        if (n <= 1000000 && revenue != bottomUp(n, pieces))
+            cout << "\tMISMATCH";
+        cout << endl;
+    }
+}
+
+int main() {
+    compareWithRecursive();
+    sparseSweep("Short pieces {7, 11, 13}", {{7, 20}, {11, 33}, {13, 40}});
+    sparseSweep("Long pieces {10^5, 2.5*10^5, 4*10^5 + 7}",
+                {{100000, 300000}, {250000, 760000}, {400007, 1250000}});
+
+    // Zero or negative piece lengths would never finish or index past memo
+    try {
+        RodCutter bad({{0, 5}, {3, 7}});
+        bad.maxRevenue(10);
+    } catch (const invalid_argument& e) {
+        cout << "Rejected: " << e.what() << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <limits>
+#include <type_traits>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+
+using namespace std;
+using namespace std::chrono;
+
+// Revenue type, chosen at compile time:
+//   g++ -O2 -DROD_VALUE_TYPE=int -o plan plan.cpp
+//   g++ -O2 -DROD_VALUE_TYPE=double -o plan plan.cpp
+#ifndef ROD_VALUE_TYPE
+#define ROD_VALUE_TYPE long long
+#endif
+typedef ROD_VALUE_TYPE Value;
+
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x) STRINGIFY_(x)
+
+// Result of one solve: the best revenue and the pieces that achieve it.
+// overflowAt is the first rod length with a cut worth more than T can hold
+// (integral types only), or 0; in that case nothing else is filled in.
+template <typename T>
+struct CutPlan {
+    T revenue;
+    vector<int> pieces;
+    int overflowAt;
+};
+
+// a + b, reporting overflow for integral T; floating point just adds
+template <typename T>
+bool addChecked(T a, T b, T& sum) {
+    if constexpr (is_integral<T>::value) {
+        return !__builtin_add_overflow(a, b, &sum);
+    } else {
+        sum = a + b;
+        return true;
+    }
+}
+
+// Tabulation as in tabu.cpp, also recording firstCut[i], the length of the
+// first piece in a best cut of a rod of length i. The plan is then read off
+// in O(n) by following firstCut from n down to 0. Ties keep the shortest
+// first piece.
+template <typename T>
+CutPlan<T> solveRodCut(int n, const vector<T>& val) {
+    CutPlan<T> plan{0, {}, 0};
+    vector<T> res(n + 1);
+    vector<int> firstCut(n + 1, 0);
+    res[0] = 0;
+
+    for (int i = 1; i <= n; i++) {
+        T best = numeric_limits<T>::lowest();
+        int cut = 0;
+        for (int j = 0; j < i; j++) {
+            T candidate;
+            if (!addChecked(val[j], res[i - (j + 1)], candidate)) {
+                if (val[j] < 0)
+                    continue; // below the minimum: never the best cut
+                plan.overflowAt = i;
+                return plan;
+            }
+            if (candidate > best) {
+                best = candidate;
+                cut = j + 1;
+            }
+        }
+        res[i] = best;
+        firstCut[i] = cut;
+    }
+
+    plan.revenue = res[n];
+    for (int rest = n; rest > 0; rest -= firstCut[rest])
+        plan.pieces.push_back(firstCut[rest]);
+    return plan;
+}
+
+// Pieces grouped as "length x count", longest first
+string summarize(const vector<int>& pieces) {
+    map<int, int, greater<int>> counts;
+    for (int p : pieces) counts[p]++;
+    string s;
+    for (auto& c : counts) {
+        if (!s.empty()) s += ", ";
+        s += to_string(c.first) + " x " + to_string(c.second);
+    }
+    return s;
+}
+
+// The plan must cover the rod exactly and sum to the reported revenue
+bool checkPlan(int n, const vector<Value>& val, const CutPlan<Value>& plan) {
+    long long length = 0;
+    Value total = 0;
+    for (int p : plan.pieces) {
+        length += p;
+        total += val[p - 1];
+    }
+    return length == n && total == plan.revenue;
+}
+
+void runSweep(const string& name, const vector<int>& lengths, Value (*price)(int)) {
+    cout << name << endl;
+    for (int n : lengths) {
+        vector<Value> val(n);
+        for (int i = 0; i < n; i++) val[i] = price(i);
+
+        auto start = high_resolution_clock::now();
+        CutPlan<Value> plan = solveRodCut(n, val);
+        auto stop = high_resolution_clock::now();
+        auto duration = duration_cast<microseconds>(stop - start);
+
+        if (plan.overflowAt) {
+            cout << "Rod length " << n << ": revenue overflows " STRINGIFY(ROD_VALUE_TYPE) " at length "
+                 << plan.overflowAt << endl;
+            continue;
+        }
+        cout << "Rod length " << n << ": revenue " << plan.revenue << ", " << plan.pieces.size()
+             << " pieces (" << summarize(plan.pieces) << "), " << duration.count() << " microseconds"
+             << (checkPlan(n, val, plan) ? "" : " INVALID PLAN") << endl;
+    }
+}
+
+int main() {
+    srand(time(0));
+    // Floating-point revenue in full, to the cent, not as 2.5e+09
+    if (is_floating_point<Value>::value)
+        cout << fixed << setprecision(2);
+    cout << "Value type: " STRINGIFY(ROD_VALUE_TYPE) << endl;
+
+    vector<Value> small = {2, 5, 7, 8, 10};
+    CutPlan<Value> example = solveRodCut(5, small);
+    cout << "Prices {2, 5, 7, 8, 10}, rod length 5: revenue " << example.revenue << ", pieces ("
+         << summarize(example.pieces) << ")" << endl;
+
+    vector<int> lengths = {10, 100, 1000, 10000, 50000};
+    // timetabu.cpp's prices, with some noise so the plan is not all 1s
+    runSweep("Prices i + 1 (+0..4)", lengths, [](int i) { return (Value)(i + 1 + rand() % 5); });
+    // 50000 per unit, capped so every price fits in 32 bits; the best
+    // totals still pass 2^31 for long rods
+    runSweep("Prices min((i + 1) * 50000, 2 * 10^9)", lengths,
+             [](int i) { return (Value)min((i + 1) * 50000LL, 2000000000LL); });
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <climits>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <algorithm>
+#include <immintrin.h>
+
+using namespace std;
+using namespace std::chrono;
+
+// Scalar tabulation from tabu.cpp, on any integer type
+template <typename T>
+T rodcut(int n, const T val[]) {
+    vector<T> res(n + 1);
+    res[0] = 0;
+
+    for (int i = 1; i <= n; i++) {
+        T best = numeric_limits<T>::min();
+        for (int j = 0; j < i; j++) {
+            best = max(best, val[j] + res[i - (j + 1)]);
+        }
+        res[i] = best;
+    }
+    return res[n];
+}
+
+// max over j < len of a[j] + b[j]: the inner loop once both operands run
+// forward. Scalar version for the tails and for builds without AVX2.
+template <typename T>
+T maxPlusScalar(const T* a, const T* b, int len, T best) {
+    for (int j = 0; j < len; j++)
+        best = max(best, a[j] + b[j]);
+    return best;
+}
+
+#if defined(__AVX512F__)
+// Lane-wise max with every mask bit set. GCC 12's plain _mm512_max_epi32/64
+// pass an undefined merge source and trip -Wmaybe-uninitialized; the masked
+// form with x as the source is the same vpmaxs instruction.
+inline __m512i max32(__m512i x, __m512i y) { return _mm512_mask_max_epi32(x, (__mmask16)-1, x, y); }
+inline __m512i max64(__m512i x, __m512i y) { return _mm512_mask_max_epi64(x, (__mmask8)-1, x, y); }
+
+// 16 int32 lanes per instruction, two accumulators
+inline int32_t maxPlus(const int32_t* a, const int32_t* b, int len) {
+    __m512i acc0 = _mm512_set1_epi32(INT32_MIN), acc1 = acc0;
+    int j = 0;
+    for (; j + 32 <= len; j += 32) {
+        __m512i s0 = _mm512_add_epi32(_mm512_loadu_si512(a + j), _mm512_loadu_si512(b + j));
+        __m512i s1 = _mm512_add_epi32(_mm512_loadu_si512(a + j + 16), _mm512_loadu_si512(b + j + 16));
+        acc0 = max32(acc0, s0);
+        acc1 = max32(acc1, s1);
+    }
+    // Reduced through memory as in the AVX2 int64 path
+    int32_t lanes[16];
+    _mm512_storeu_si512(lanes, max32(acc0, acc1));
+    int32_t best = *max_element(lanes, lanes + 16);
+    return maxPlusScalar(a + j, b + j, len - j, best);
+}
+
+// 8 int64 lanes per instruction, two accumulators
+inline int64_t maxPlus(const int64_t* a, const int64_t* b, int len) {
+    __m512i acc0 = _mm512_set1_epi64(INT64_MIN), acc1 = acc0;
+    int j = 0;
+    for (; j + 16 <= len; j += 16) {
+        __m512i s0 = _mm512_add_epi64(_mm512_loadu_si512(a + j), _mm512_loadu_si512(b + j));
+        __m512i s1 = _mm512_add_epi64(_mm512_loadu_si512(a + j + 8), _mm512_loadu_si512(b + j + 8));
+        acc0 = max64(acc0, s0);
+        acc1 = max64(acc1, s1);
+    }
+    int64_t lanes[8];
+    _mm512_storeu_si512(lanes, max64(acc0, acc1));
+    int64_t best = *max_element(lanes, lanes + 8);
+    return maxPlusScalar(a + j, b + j, len - j, best);
+}
+#elif defined(__AVX2__)
+// 8 int32 lanes per instruction, two accumulators (16 per iteration)
+inline int32_t maxPlus(const int32_t* a, const int32_t* b, int len) {
+    __m256i acc0 = _mm256_set1_epi32(INT32_MIN), acc1 = acc0;
+    int j = 0;
+    for (; j + 16 <= len; j += 16) {
+        __m256i s0 = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(a + j)),
+                                      _mm256_loadu_si256((const __m256i*)(b + j)));
+        __m256i s1 = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(a + j + 8)),
+                                      _mm256_loadu_si256((const __m256i*)(b + j + 8)));
+        acc0 = _mm256_max_epi32(acc0, s0);
+        acc1 = _mm256_max_epi32(acc1, s1);
+    }
+    __m256i acc = _mm256_max_epi32(acc0, acc1);
+    __m128i m = _mm_max_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return maxPlusScalar(a + j, b + j, len - j, _mm_cvtsi128_si32(m));
+}
+
+// AVX2 has no 64-bit max: compare greater-than, then blend
+inline __m256i max64(__m256i x, __m256i y) {
+    return _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi64(x, y));
+}
+
+// 4 int64 lanes per instruction, two accumulators
+inline int64_t maxPlus(const int64_t* a, const int64_t* b, int len) {
+    __m256i acc0 = _mm256_set1_epi64x(INT64_MIN), acc1 = acc0;
+    int j = 0;
+    for (; j + 8 <= len; j += 8) {
+        __m256i s0 = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(a + j)),
+                                      _mm256_loadu_si256((const __m256i*)(b + j)));
+        __m256i s1 = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(a + j + 4)),
+                                      _mm256_loadu_si256((const __m256i*)(b + j + 4)));
+        acc0 = max64(acc0, s0);
+        acc1 = max64(acc1, s1);
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, max64(acc0, acc1));
+    int64_t best = max(max(lanes[0], lanes[1]), max(lanes[2], lanes[3]));
+    return maxPlusScalar(a + j, b + j, len - j, best);
+}
+#else
+template <typename T>
+T maxPlus(const T* a, const T* b, int len) {
+    return maxPlusScalar(a, b, len, numeric_limits<T>::min());
+}
+#endif
+
+// Tabulation with a reversed copy of res: rev[n - k] = res[k], so
+// res[i - 1 - j] = rev[n - i + 1 + j] and for each i the inner loop reads
+// val[0..i) and rev[n - i + 1 ..) both forward
+template <typename T>
+T rodcutSimd(int n, const T val[]) {
+    vector<T> rev(n + 1);
+    rev[n] = 0; // res[0]
+    T last = 0;
+    for (int i = 1; i <= n; i++) {
+        last = maxPlus(val, rev.data() + n - i + 1, i);
+        rev[n - i] = last;
+    }
+    return last;
+}
+
+const char* simdName() {
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "scalar (no AVX2)";
+#endif
+}
+
+// Prices as in timetabu.cpp (length i + 1 sells for about i + 1) with some
+// noise so the best cut is not trivial
+template <typename T>
+void measure(const string& type, int n) {
+    vector<T> val(n);
+    for (int i = 0; i < n; i++) val[i] = i + 1 + rand() % 3;
+
+    auto start = high_resolution_clock::now();
+    T scalar = rodcut(n, val.data());
+    auto mid = high_resolution_clock::now();
+    T simd = rodcutSimd(n, val.data());
+    auto stop = high_resolution_clock::now();
+
+    double scalarTime = duration<double>(mid - start).count();
+    double simdTime = duration<double>(stop - mid).count();
+    double ops = 2.0 * n * (n + 1) / 2; // one add and one max per inner iteration
+    cout << type << "\t" << n << "\t" << scalarTime << "\t" << ops / scalarTime / 1e9 << "\t" << simdTime << "\t"
+         << ops / simdTime / 1e9 << "\t" << scalarTime / simdTime << (scalar == simd ? "" : "\tMISMATCH") << endl;
+}
+
+int main(int argc, char* argv[]) {
+    srand(time(0));
+    // Usage: simd [int32|int64|all]
+    string type = argc > 1 ? argv[1] : "all";
+    vector<int> lengths = {10000, 20000, 50000, 100000};
+
+    cout << "Kernel: " << simdName() << endl;
+    cout << "Type\tLength\tscalar (s)\tscalar GOP/s\tSIMD (s)\tSIMD GOP/s\tSpeedup" << endl;
+    for (int n : lengths) {
+        if (type == "int32" || type == "all")
+            measure<int32_t>("int32", n);
+        if (type == "int64" || type == "all")
+            measure<int64_t>("int64", n);
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+using namespace std::chrono;
+
+// Dense tabulation from tabu.cpp: every length 1..n has a price
+int rodcut(int n, int val[]) {
+    int res[n + 1];
+    res[0] = 0;
+
+    for (int i = 1; i <= n; i++) {
+        res[i] = INT_MIN;
+        for (int j = 0; j < i; j++) {
+            res[i] = max(res[i], val[j] + res[i - (j + 1)]);
+        }
+    }
+    return res[n];
+}
+
+// A priced piece length from the cut catalog
+struct Piece {
+    int length;
+    long long price;
+};
+
+// Bottom-up rod cutting over only the priced lengths, O(n * k) for k
+// pieces. Lengths without a price sell for nothing, so res[i] may also just
+// be res[i - 1] (one unit left over). Pieces are sorted by length so the
+// inner loop stops at the first piece longer than i. A piece length of 0 or
+// less, or a negative n, throws invalid_argument.
+long long rodCuttingSparse(int n, vector<Piece> pieces) {
+    if (n < 0)
+        throw invalid_argument("rod length must be non-negative: " + to_string(n));
+    for (const Piece& p : pieces)
+        if (p.length <= 0)
+            throw invalid_argument("piece length must be positive: " + to_string(p.length));
+    sort(pieces.begin(), pieces.end(), [](const Piece& a, const Piece& b) { return a.length < b.length; });
+    vector<long long> res(n + 1);
+    res[0] = 0;
+    for (int i = 1; i <= n; i++) {
+        long long best = res[i - 1];
+        for (const Piece& p : pieces) {
+            if (p.length > i)
+                break;
+            best = max(best, p.price + res[i - p.length]);
+        }
+        res[i] = best;
+    }
+    return res[n];
+}
+
+// k distinct lengths in [1, maxLength], priced at 2-3 per unit
+vector<Piece> randomCatalog(int k, int maxLength) {
+    vector<int> lengths(maxLength);
+    for (int i = 0; i < maxLength; i++) lengths[i] = i + 1;
+    vector<Piece> pieces;
+    for (int i = 0; i < k; i++) {
+        swap(lengths[i], lengths[i + rand() % (maxLength - i)]);
+        pieces.push_back(Piece{lengths[i], (long long)lengths[i] * (200 + rand() % 101) / 100});
+    }
+    return pieces;
+}
+
+// The same catalog as a dense value[] for rodcut: unpriced lengths get 0
+vector<int> denseValues(const vector<Piece>& pieces, int n) {
+    vector<int> val(n, 0);
+    for (const Piece& p : pieces)
+        if (p.length <= n)
+            val[p.length - 1] = p.price;
+    return val;
+}
+
+int main() {
+    srand(time(0));
+    vector<Piece> catalog = randomCatalog(300, 2000);
+
+    vector<int> lengths = {1000, 10000, 50000, 100000, 1000000, 10000000};
+    cout << "Catalog: 300 priced lengths in [1, 2000]" << endl;
+    cout << "Length\tdense O(n^2) (us)\tsparse O(nk) (us)\tRevenue" << endl;
+    for (int n : lengths) {
+        auto start = high_resolution_clock::now();
+        long long sparse = rodCuttingSparse(n, catalog);
+        auto stop = high_resolution_clock::now();
+        long long sparseTime = duration_cast<microseconds>(stop - start).count();
+
+        // The dense loop is skipped where it would take minutes
+        if (n <= 50000) {
+            vector<int> val = denseValues(catalog, n);
+            start = high_resolution_clock::now();
+            int dense = rodcut(n, val.data());
+            stop = high_resolution_clock::now();
+            cout << n << "\t" << duration_cast<microseconds>(stop - start).count() << "\t" << sparseTime << "\t"
+                 << sparse << (dense == sparse ? "" : "\tMISMATCH") << endl;
+        } else {
+            cout << n << "\t-\t" << sparseTime << "\t" << sparse << endl;
+        }
+    }
+    return 0;
+}